@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Module: Timing
+ *
+ * File Name: Timing.h
+ *
+ * Description: Header file for the cycle-accurate delays and time measurement
+ *              on the ARM Cortex M4 DWT cycle counter (CYCCNT)
+ *
+ *              Built with TIMING_HOST_BUILD defined the counter is a virtual clock
+ *              advanced by every reading and by Timing_HostAdvance, so the module
+ *              runs on a PC without the core (Host/Timing_HostTest.c).
+ *
+ * Author: Zeyad Hisham Elsayed
+ *
+ *******************************************************************************/
+
+#ifndef TIMING_H_
+#define TIMING_H_
+
+#include "../../std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+#define TIMING_TRCENA_MASK                   0x01000000    /* DEMCR trace enable, powers the DWT */
+#define TIMING_CYCCNTENA_MASK                0x00000001    /* DWT_CTRL cycle counter enable */
+#define TIMING_DWT_UNLOCK_KEY                0xC5ACCE55
+
+/* Longest wait in cycles done in one step, the signed comparison with the deadline holds up to 2^31 */
+#define TIMING_MAX_WAIT_CYCLES               0x7FFFFFFF
+
+#ifdef TIMING_HOST_BUILD
+/* Virtual cycles spent by one reading of the counter (the cost of a polling loop iteration) */
+#define TIMING_HOST_CYCLES_PER_READ          4
+#endif
+
+/*******************************************************************************
+ *                                  Functions                                  *
+ *******************************************************************************/
+
+/*****************************************************************************************
+ * Function Name: Timing_Init
+ * Parameters (in): a_ClockHz - System clock frequency in Hz (multiple of 1 MHz)
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enables the DWT cycle counter, it counts the core clock and wraps every 2^32 cycles.
+ *****************************************************************************************/
+void Timing_Init(uint32 a_ClockHz);
+
+/*****************************************************************************************
+ * Function Name: Timing_GetCycles
+ * Parameters (in): None
+ * Parameters (out): None
+ * Return value: Current value of the cycle counter
+ * Description: Reads the cycle counter, the unsigned difference of two readings is wrap safe.
+ *****************************************************************************************/
+uint32 Timing_GetCycles(void);
+
+/*****************************************************************************************
+ * Function Name: Timing_GetElapsedCycles
+ * Parameters (in): a_StartCycles - Reading of Timing_GetCycles at the start of the measurement
+ * Parameters (out): None
+ * Return value: Cycles elapsed since a_StartCycles (less than 2^32)
+ * Description: Measures the execution time of a code section.
+ *****************************************************************************************/
+uint32 Timing_GetElapsedCycles(uint32 a_StartCycles);
+
+/*****************************************************************************************
+ * Function Name: Timing_CyclesToUs
+ * Parameters (in): a_Cycles - Number of core cycles
+ * Parameters (out): None
+ * Return value: Time of the cycles in us (rounded down)
+ * Description: Converts a measured number of cycles to us.
+ *****************************************************************************************/
+uint32 Timing_CyclesToUs(uint32 a_Cycles);
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayCycles
+ * Parameters (in): a_Cycles - Cycles to wait
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given cycles, at most one polling iteration more
+ *              whatever the compiler and optimization level.
+ *****************************************************************************************/
+void Timing_DelayCycles(uint32 a_Cycles);
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayUs
+ * Parameters (in): a_TimeInMicroSeconds - Time to wait in us
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits the given time counted in core cycles.
+ *****************************************************************************************/
+void Timing_DelayUs(uint32 a_TimeInMicroSeconds);
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayMs
+ * Parameters (in): a_TimeInMilliSeconds - Time to wait in ms
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits the given time counted in core cycles, any length without drift.
+ *****************************************************************************************/
+void Timing_DelayMs(uint32 a_TimeInMilliSeconds);
+
+#ifdef TIMING_HOST_BUILD
+/*****************************************************************************************
+ * Function Name: Timing_HostAdvance
+ * Parameters (in): a_Cycles - Virtual cycles spent
+ * Parameters (out): None
+ * Return value: None
+ * Description: Host build only ... moves the virtual clock as if the core ran the cycles.
+ *****************************************************************************************/
+void Timing_HostAdvance(uint32 a_Cycles);
+#endif
+
+#endif /* TIMING_H_ */
@@ -1,29 +1,22 @@
 #include "tm4c123gh6pm_registers.h"
 #include "MCAL/NVIC/NVIC.h"
 #include "MCAL/SysTick/SysTick.h"
+#include "MCAL/Timing/Timing.h"
 #include "std_types.h"
 
 #define GPIO_PORTF_IRQ_NUM                30
 #define GPIO_PORTF_INTERRUPT_PRIORITY     2
 #define SYSTICK_INTERRUPT_PRIORITY        1
 
-#define NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND 364
-
 /* Global variable to count time in seconds */
 volatile uint8 g_Counter = 0;
 
-void Delay_MS(unsigned long long n)
-{
-    volatile uint64 count = 0;
-    while(count++ < (NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND * n) );
-}
-
 /* GPIO PORTF External Interrupt - ISR */
 void GPIOPortF_Handler(void)
 {
     SysTick_Stop();
     GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x0E; /* Turn on the Red, Blue and Green LEDs */
-    Delay_MS(5000);
+    Timing_DelayMs(5000);                 /* Counted in core cycles, same time in any build */
     SysTick_Start();
     GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
 }
@@ -86,6 +79,9 @@ int main(void)
     SYSCTL_RCGCGPIO_REG |= 0x20;
     while(!(SYSCTL_PRGPIO_REG & 0x20));
 
+    /* Enable the cycle counter used by the delays */
+    Timing_Init(CPU_CLK);
+
     /* Initialize the SW2(PF0) as GPIO Pin and activate external interrupt with falling edge */
     SW2_Init();
 
@@ -95,7 +91,7 @@ int main(void)
     /* Start SysTick Timer to generate interrupt every 1 second */
     SysTick_Init(1000);
     NVIC_SetPriorityException(EXCEPTION_SYSTICK_TYPE,SYSTICK_INTERRUPT_PRIORITY);
-    SysTick_SetCallBack(SysTick_CallBackFunc);
+    SysTick_AddSubscriber(SysTick_CallBackFunc, 1);
 
     /* Enable Interrupts, Exceptions and Faults */
     Enable_Exceptions();
@@ -142,6 +142,24 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/*****************************************************************************
+Wide General-Purpose Timer 5 Registers
+*****************************************************************************/
+#define WTIMER5_CFG_REG           (*((volatile uint32 *)0x4004F000))
+#define WTIMER5_TAMR_REG          (*((volatile uint32 *)0x4004F004))
+#define WTIMER5_CTL_REG           (*((volatile uint32 *)0x4004F00C))
+#define WTIMER5_TAILR_REG         (*((volatile uint32 *)0x4004F028))
+#define WTIMER5_TAPR_REG          (*((volatile uint32 *)0x4004F038))
+#define WTIMER5_TAV_REG           (*((volatile uint32 *)0x4004F050))
+
+/*****************************************************************************
+Debug Exception and Monitor Control and Data Watchpoint and Trace Registers
+*****************************************************************************/
+#define DEMCR_REG                 (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+#define DWT_LAR_REG               (*((volatile uint32 *)0xE0001FB0))
+
 /*****************************************************************************
 NVIC Registers
 *****************************************************************************/
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Module: Delay
+ *
+ * File Name: Delay.h
+ *
+ * Description: Header file for the delay service on a free-running Wide Timer 5A
+ *              (SysTick is left to its interrupt users)
+ *
+ * Author: Zeyad Hisham Elsayed
+ *
+ *******************************************************************************/
+
+#ifndef DELAY_H_
+#define DELAY_H_
+
+#include "../../std_types.h"
+
+/*******************************************************************************
+ *                           Preprocessor Definitions                          *
+ *******************************************************************************/
+
+#define DELAY_TIMER_CLOCK_ENABLE_MASK        0x20          /* Wide Timer 5 bit in RCGCWTIMER/PRWTIMER */
+#define DELAY_TIMER_ENABLE_MASK              0x00000001    /* TAEN */
+#define DELAY_TIMER_CONFIG_32_BIT            0x00000004    /* Wide timer split in two 32-bit timers with prescaler */
+#define DELAY_TIMER_PERIODIC_MODE            0x00000002    /* Periodic mode counting down */
+#define DELAY_TIMER_MAX_VALUE                0xFFFFFFFF
+
+/*******************************************************************************
+ *                           Data Types Declarations                           *
+ *******************************************************************************/
+
+/* Non-blocking delay ... start time and length in us of the timer */
+typedef struct
+{
+    uint32 Start;
+    uint32 Length;
+} Delay_TimerType;
+
+/*******************************************************************************
+ *                                  Functions                                  *
+ *******************************************************************************/
+
+/*****************************************************************************************
+ * Function Name: Delay_Init
+ * Parameters (in): a_ClockHz - System clock frequency in Hz (multiple of 1 MHz)
+ * Parameters (out): None
+ * Return value: None
+ * Description: Starts Wide Timer 5A as a free-running counter of 1 us ticks,
+ *              it wraps every 71 minutes without interrupt.
+ *****************************************************************************************/
+void Delay_Init(uint32 a_ClockHz);
+
+/*****************************************************************************************
+ * Function Name: Delay_GetTimeUs
+ * Parameters (in): None
+ * Parameters (out): None
+ * Return value: Free-running time in us (wraps every 2^32 us)
+ * Description: Reads the counter, the difference of two readings is the elapsed time.
+ *****************************************************************************************/
+uint32 Delay_GetTimeUs(void);
+
+/*****************************************************************************************
+ * Function Name: Delay_Us
+ * Parameters (in): a_TimeInMicroSeconds - Time to wait in us
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given time, the interrupts keep being served.
+ *****************************************************************************************/
+void Delay_Us(uint32 a_TimeInMicroSeconds);
+
+/*****************************************************************************************
+ * Function Name: Delay_Ms
+ * Parameters (in): a_TimeInMilliSeconds - Time to wait in ms
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given time, the interrupts keep being served.
+ *****************************************************************************************/
+void Delay_Ms(uint16 a_TimeInMilliSeconds);
+
+/*****************************************************************************************
+ * Function Name: Delay_Start
+ * Parameters (in): a_TimeInMilliSeconds - Length of the delay in ms (up to 71 minutes)
+ * Parameters (out): a_Timer - Delay to start
+ * Return value: None
+ * Description: Starts a non-blocking delay polled with Delay_IsExpired.
+ *****************************************************************************************/
+void Delay_Start(Delay_TimerType *a_Timer, uint32 a_TimeInMilliSeconds);
+
+/*****************************************************************************************
+ * Function Name: Delay_IsExpired
+ * Parameters (in): a_Timer - Delay started by Delay_Start
+ * Parameters (out): None
+ * Return value: TRUE once the delay length elapsed since its start
+ * Description: Polls a non-blocking delay, the result is valid for 71 minutes after the expiry.
+ *****************************************************************************************/
+boolean Delay_IsExpired(const Delay_TimerType *a_Timer);
+
+/*****************************************************************************************
+ * Function Name: Delay_Restart
+ * Parameters (in): a_Timer - Expired delay
+ * Parameters (out): a_Timer - Same delay started at the end of the previous one
+ * Return value: None
+ * Description: Starts the same delay again from the end of the previous one, a periodic
+ *              action polled late does not drift.
+ *****************************************************************************************/
+void Delay_Restart(Delay_TimerType *a_Timer);
+
+#endif /* DELAY_H_ */
@@ -13,7 +13,61 @@
 #include "SysTick.h"
 #include "../../tm4c123gh6pm_registers.h"
 
-static volatile void (*g_SysTickCallBack)(void) = NULL_PTR;
+/*
+ * SysTick subscribers ... each one is called every Divisor periods when its Countdown reaches 0,
+ * a free entry has a NULL_PTR Callback
+ */
+typedef struct
+{
+    void (*volatile Callback)(void);
+    uint16 Divisor;
+    uint16 Countdown;
+} SysTick_SubscriberType;
+
+static SysTick_SubscriberType g_SysTickSubscribers[SYSTICK_MAX_SUBSCRIBERS];
+
+/* Masks the interrupts and returns the previous PRIMASK */
+uint32 SysTick_EnterCritical(void);
+
+/* Restores a PRIMASK value */
+void SysTick_ExitCritical(uint32 a_Primask);
+
+__asm("        .thumb                          \n"
+      "        .global SysTick_EnterCritical   \n"
+      "        .global SysTick_ExitCritical    \n"
+      "SysTick_EnterCritical:                  \n"
+      "        MRS      R0, PRIMASK            \n"
+      "        CPSID    I                      \n"
+      "        BX       LR                     \n"
+      "SysTick_ExitCritical:                   \n"
+      "        MSR      PRIMASK, R0            \n"
+      "        BX       LR                     \n");
+
+/* System clock counted by SysTick, the reset clock until SysTick_SetClockFrequency */
+static uint32 g_SysTickClock = CPU_CLK;
+
+/* Timer periods making one SysTick_Init period and timer periods left in the current one */
+static uint16 g_SysTickChainLength = 1;
+static volatile uint16 g_SysTickChainCount = 1;
+
+/*****************************************************************************************
+ * Function Name: SysTick_ComputeReload
+ * Parameters (in): a_TimeInMilliSeconds - Time in milliseconds
+ * Parameters (out): a_Chain - Number of equal timer periods making the time
+ * Return value: Reload value of one timer period
+ * Description: Splits the time in the fewest equal periods that fit the 24-bit reload register,
+ *              periods of 1 ms always fit so the time is exact for any clock multiple of 1 kHz.
+ *****************************************************************************************/
+static uint32 SysTick_ComputeReload(uint16 a_TimeInMilliSeconds, uint16 *a_Chain) {
+    uint64 counts = (uint64)(g_SysTickClock / 1000) * a_TimeInMilliSeconds;
+    uint16 chain = (uint16)((counts + SYSTICK_MAX_RELOAD) / (SYSTICK_MAX_RELOAD + 1));
+
+    while ((chain == 0) || ((counts % chain) != 0)) {
+        chain++;
+    }
+    *a_Chain = chain;
+    return (uint32)(counts / chain) - 1;
+}
 
 /*****************************************************************************************
  * Function Name: SysTick_Init
@@ -21,10 +75,16 @@ static volatile void (*g_SysTickCallBack)(void) = NULL_PTR;
  * Parameters (out): None
  * Return value: None
  * Description: Initializes SysTick timer with the given time in milliseconds using interrupts.
+ *              A time that does not fit the 24-bit reload is made of several equal timer periods,
+ *              the subscribers count the last one only.
  *****************************************************************************************/
 void SysTick_Init(uint16 a_TimeInMilliSeconds) {
+    uint16 chain;
+
     SYSTICK_CTRL_REG = 0;  /* Disable SysTick Timer */
-    SYSTICK_RELOAD_REG = ((CPU_CLK / 1000) * a_TimeInMilliSeconds) - 1; /* Set reload value */
+    SYSTICK_RELOAD_REG = SysTick_ComputeReload(a_TimeInMilliSeconds, &chain); /* Set reload value */
+    g_SysTickChainLength = chain;
+    g_SysTickChainCount = chain;
     SYSTICK_CURRENT_REG = 0;  /* Clear current value */
     SysTick_Start();  /* Start SysTick timer */
 }
@@ -43,19 +103,15 @@ void SysTick_DeInit(void) {
 }
 
 /*****************************************************************************************
- * Function Name: SysTick_StartBusyWait
- * Parameters (in): a_TimeInMilliSeconds - Time in milliseconds for the delay
+ * Function Name: SysTick_SetClockFrequency
+ * Parameters (in): a_ClockHz - System clock frequency in Hz
  * Parameters (out): None
  * Return value: None
- * Description: Starts SysTick in busy-wait mode for the specified time in milliseconds.
+ * Description: Sets the clock the reload values are computed from, to be called after the
+ *              system clock is changed (PLL) and before SysTick_Init.
  *****************************************************************************************/
-void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds) {
-    SYSTICK_CTRL_REG = 0;  /* Disable SysTick Timer */
-    SYSTICK_RELOAD_REG = ((CPU_CLK / 1000) * a_TimeInMilliSeconds) - 1;
-    SYSTICK_CURRENT_REG = 0;  /* Clear current value */
-    SYSTICK_CTRL_REG = (1 << SYSTICK_CLK_SELECT_BIT) | (1 << SYSTICK_ENABLE_BIT);
-    while (!(SYSTICK_CTRL_REG & (1 << SYSTICK_COUNT_FLAG_BIT)));  /* Wait until COUNTFLAG is set */
-    SYSTICK_CTRL_REG = 0;  /* Disable SysTick after wait */
+void SysTick_SetClockFrequency(uint32 a_ClockHz) {
+    g_SysTickClock = a_ClockHz;
 }
 
 /*****************************************************************************************
@@ -83,14 +139,71 @@ void SysTick_Start(void) {
 }
 
 /*****************************************************************************************
- * Service Name: SysTick_SetCallBack
- * Parameters (in): Ptr2Func - Pointer to the callback function
+ * Service Name: SysTick_AddSubscriber
+ * Parameters (in): a_Ptr2Func - Pointer to the callback function
+ *                  a_Divisor - Number of SysTick periods between two calls (1 .. 65535)
  * Parameters (out): None
- * Return value: None
- * Description: Sets the callback function to be called in the SysTick interrupt.
+ * Return value: TRUE if added, FALSE if NULL_PTR, already added, a_Divisor is 0 or the table is full
+ * Description: Adds a function called in the SysTick interrupt every a_Divisor periods, the first
+ *              call is a_Divisor periods after this one. The table is updated with the interrupts
+ *              masked so it can be called from any context.
  *****************************************************************************************/
-void SysTick_SetCallBack(volatile void (*Ptr2Func)(void)) {
-    g_SysTickCallBack = Ptr2Func;
+boolean SysTick_AddSubscriber(void (*a_Ptr2Func)(void), uint16 a_Divisor) {
+    boolean added = FALSE;
+    uint8 index;
+    uint8 free_index = SYSTICK_MAX_SUBSCRIBERS;
+    uint32 primask;
+
+    if ((a_Ptr2Func == NULL_PTR) || (a_Divisor == 0)) {
+        return FALSE;
+    }
+
+    primask = SysTick_EnterCritical();
+    for (index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++) {
+        if (g_SysTickSubscribers[index].Callback == a_Ptr2Func) {
+            free_index = SYSTICK_MAX_SUBSCRIBERS;  /* Already added, keep the removal unambiguous */
+            break;
+        }
+        if ((g_SysTickSubscribers[index].Callback == NULL_PTR) && (free_index == SYSTICK_MAX_SUBSCRIBERS)) {
+            free_index = index;
+        }
+    }
+    if (free_index != SYSTICK_MAX_SUBSCRIBERS) {
+        /* The Callback is written last, the entry is complete when the interrupt sees it */
+        g_SysTickSubscribers[free_index].Divisor = a_Divisor;
+        g_SysTickSubscribers[free_index].Countdown = a_Divisor;
+        g_SysTickSubscribers[free_index].Callback = a_Ptr2Func;
+        added = TRUE;
+    }
+    SysTick_ExitCritical(primask);
+
+    return added;
+}
+
+/*****************************************************************************************
+ * Service Name: SysTick_RemoveSubscriber
+ * Parameters (in): a_Ptr2Func - Pointer to the callback function added by SysTick_AddSubscriber
+ * Parameters (out): None
+ * Return value: TRUE if removed, FALSE if it is not a subscriber
+ * Description: Stops calling a function in the SysTick interrupt. It is not called after the
+ *              return unless the removal preempted the SysTick interrupt (then once more).
+ *****************************************************************************************/
+boolean SysTick_RemoveSubscriber(void (*a_Ptr2Func)(void)) {
+    boolean removed = FALSE;
+    uint8 index;
+    uint32 primask;
+
+    primask = SysTick_EnterCritical();
+    for (index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++) {
+        if ((a_Ptr2Func != NULL_PTR) && (g_SysTickSubscribers[index].Callback == a_Ptr2Func)) {
+            g_SysTickSubscribers[index].Callback = NULL_PTR;
+            removed = TRUE;
+            break;
+        }
+    }
+    SysTick_ExitCritical(primask);
+
+    return removed;
 }
 
 /*****************************************************************************************
@@ -98,10 +211,24 @@ void SysTick_SetCallBack(volatile void (*Ptr2Func)(void)) {
  * Parameters (in): None
  * Parameters (out): None
  * Return value: None
- * Description: SysTick interrupt handler that calls the callback function.
+ * Description: SysTick interrupt handler that calls the subscribers due in this period.
  *****************************************************************************************/
 void SysTick_Handler(void) {
-    if (g_SysTickCallBack != NULL_PTR) {
-        (*g_SysTickCallBack)();
+    uint8 index;
+    void (*callback)(void);
+
+    /* Serve the subscribers on the last timer period of a chained period only */
+    if (--g_SysTickChainCount != 0) {
+        return;
+    }
+    g_SysTickChainCount = g_SysTickChainLength;
+
+    /* A count down per subscriber ... no division in the interrupt */
+    for (index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++) {
+        callback = g_SysTickSubscribers[index].Callback;
+        if ((callback != NULL_PTR) && (--g_SysTickSubscribers[index].Countdown == 0)) {
+            g_SysTickSubscribers[index].Countdown = g_SysTickSubscribers[index].Divisor;
+            callback();
+        }
     }
 }
@@ -1,5 +1,6 @@
 #include "MCAL/SysTick/SysTick.h"
 #include "MCAL/NVIC/NVIC.h"
+#include "MCAL/Delay/Delay.h"
 #include "tm4c123gh6pm_registers.h"
 #include <assert.h>
 
@@ -11,6 +12,10 @@
 #define PENDSV_EXCEPTION_PRIORITY           6
 #define SYSTICK_EXCEPTION_PRIORITY          7
 
+#define LED_SWITCH_TIME_MS                  1000
+#define RED_LED_MASK                        0x02
+#define GREEN_LED_MASK                      0x08
+
 /* Enable PF1, PF2 and PF3 (RED, Blue and Green LEDs) */
 void Leds_Init(void)
 {
@@ -76,6 +81,9 @@ void Test_Exceptions_Settings(void)
 
 int main(void)
 {
+    Delay_TimerType led_delay;
+    uint8 led_mask = RED_LED_MASK;
+
     /* Enable clock for PORTF and wait for clock to start */
     SYSCTL_RCGCGPIO_REG |= 0x20;
     while(!(SYSCTL_PRGPIO_REG & 0x20));
@@ -83,6 +91,9 @@ int main(void)
     /* Initialize the LEDs as GPIO Pins */
     Leds_Init();
 
+    /* Start the free-running counter of the delay service, SysTick stays free */
+    Delay_Init(CPU_CLK);
+
     /* Enable Interrupts, Exceptions and Faults */
     Enable_Exceptions();
     Enable_Faults();
@@ -90,13 +101,17 @@ int main(void)
     /* Test all System and Fault Exceptions settings */
     Test_Exceptions_Settings();
 
+    GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | led_mask; /* Turn on the Red LED and disable the others */
+    Delay_Start(&led_delay, LED_SWITCH_TIME_MS);
+
     while(1)
     {
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x02; /* Turn on the Red LED and disable the others */
-        SysTick_StartBusyWait(1000); /* Wait 1 second using SysTick Timer */
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x04; /* Turn on the Blue LED and disable the others */
-        SysTick_StartBusyWait(1000); /* Wait 1 second using SysTick Timer */
-        GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | 0x08; /* Turn on the Green LED and disable the others */
-        SysTick_StartBusyWait(1000); /* Wait 1 second using SysTick Timer */
+        /* Move to the next LED (Red, Blue then Green) every second without blocking the loop */
+        if(Delay_IsExpired(&led_delay))
+        {
+            Delay_Restart(&led_delay);
+            led_mask = (led_mask == GREEN_LED_MASK) ? RED_LED_MASK : (led_mask << 1);
+            GPIO_PORTF_DATA_REG = (GPIO_PORTF_DATA_REG & 0xF1) | led_mask;
+        }
     }
 }
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Module: Delay
+ *
+ * File Name: Delay.c
+ *
+ * Description: Source file for the delay service on a free-running Wide Timer 5A
+ *
+ * Author: Zeyad Hisham Elsayed
+ *
+ *******************************************************************************/
+
+#include "Delay.h"
+#include "../../tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                              Functions Definitions                          *
+ *******************************************************************************/
+
+/*****************************************************************************************
+ * Function Name: Delay_Init
+ * Parameters (in): a_ClockHz - System clock frequency in Hz (multiple of 1 MHz)
+ * Parameters (out): None
+ * Return value: None
+ * Description: Starts Wide Timer 5A as a free-running counter of 1 us ticks,
+ *              it wraps every 71 minutes without interrupt.
+ *****************************************************************************************/
+void Delay_Init(uint32 a_ClockHz)
+{
+    /* Enable clock for Wide Timer 5 and wait for clock to start */
+    SYSCTL_RCGCWTIMER_REG |= DELAY_TIMER_CLOCK_ENABLE_MASK;
+    while(!(SYSCTL_PRWTIMER_REG & DELAY_TIMER_CLOCK_ENABLE_MASK));
+
+    WTIMER5_CTL_REG   &= ~DELAY_TIMER_ENABLE_MASK;         /* Disable Timer A while configuring it */
+    WTIMER5_CFG_REG    = DELAY_TIMER_CONFIG_32_BIT;
+    WTIMER5_TAMR_REG   = DELAY_TIMER_PERIODIC_MODE;        /* Reloads itself, no interrupt enabled */
+    WTIMER5_TAPR_REG   = (a_ClockHz / 1000000) - 1;        /* The prescaler divides the clock down to 1 MHz */
+    WTIMER5_TAILR_REG  = DELAY_TIMER_MAX_VALUE;
+    WTIMER5_CTL_REG   |= DELAY_TIMER_ENABLE_MASK;
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_GetTimeUs
+ * Parameters (in): None
+ * Parameters (out): None
+ * Return value: Free-running time in us (wraps every 2^32 us)
+ * Description: Reads the counter, the difference of two readings is the elapsed time.
+ *****************************************************************************************/
+uint32 Delay_GetTimeUs(void)
+{
+    /* The timer counts down, its complement counts up */
+    return ~WTIMER5_TAV_REG;
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_Us
+ * Parameters (in): a_TimeInMicroSeconds - Time to wait in us
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given time, the interrupts keep being served.
+ *****************************************************************************************/
+void Delay_Us(uint32 a_TimeInMicroSeconds)
+{
+    uint32 start = Delay_GetTimeUs();
+
+    /* One more tick as the start reading may be at the end of its us, unsigned difference is wrap safe */
+    while((Delay_GetTimeUs() - start) <= a_TimeInMicroSeconds);
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_Ms
+ * Parameters (in): a_TimeInMilliSeconds - Time to wait in ms
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given time, the interrupts keep being served.
+ *****************************************************************************************/
+void Delay_Ms(uint16 a_TimeInMilliSeconds)
+{
+    Delay_Us((uint32)a_TimeInMilliSeconds * 1000);
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_Start
+ * Parameters (in): a_TimeInMilliSeconds - Length of the delay in ms (up to 71 minutes)
+ * Parameters (out): a_Timer - Delay to start
+ * Return value: None
+ * Description: Starts a non-blocking delay polled with Delay_IsExpired.
+ *****************************************************************************************/
+void Delay_Start(Delay_TimerType *a_Timer, uint32 a_TimeInMilliSeconds)
+{
+    a_Timer->Start  = Delay_GetTimeUs();
+    a_Timer->Length = a_TimeInMilliSeconds * 1000;
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_IsExpired
+ * Parameters (in): a_Timer - Delay started by Delay_Start
+ * Parameters (out): None
+ * Return value: TRUE once the delay length elapsed since its start
+ * Description: Polls a non-blocking delay, the result is valid for 71 minutes after the expiry.
+ *****************************************************************************************/
+boolean Delay_IsExpired(const Delay_TimerType *a_Timer)
+{
+    return ((Delay_GetTimeUs() - a_Timer->Start) >= a_Timer->Length) ? TRUE : FALSE;
+}
+
+/*****************************************************************************************
+ * Function Name: Delay_Restart
+ * Parameters (in): a_Timer - Expired delay
+ * Parameters (out): a_Timer - Same delay started at the end of the previous one
+ * Return value: None
+ * Description: Starts the same delay again from the end of the previous one, a periodic
+ *              action polled late does not drift.
+ *****************************************************************************************/
+void Delay_Restart(Delay_TimerType *a_Timer)
+{
+    a_Timer->Start += a_Timer->Length;
+}
@@ -19,7 +19,9 @@
  *                             PreProcessor Macros                             *
  *******************************************************************************/
 
-#define CPU_CLK 16000000
+#define CPU_CLK 16000000                  /* System clock after reset (PIOSC) */
+#define SYSTICK_MAX_RELOAD 0x00FFFFFF     /* 24-bit reload register */
+#define SYSTICK_MAX_SUBSCRIBERS 4         /* Size of the subscriber table (at most 255) */
 #define SYSTICK_ENABLE_BIT 0
 #define SYSTICK_INTERRUPT_ENABLE_BIT 1
 #define SYSTICK_CLK_SELECT_BIT 2
@@ -35,39 +37,54 @@
  * Parameters (out): None
  * Return value: None
  * Description: Initializes SysTick timer with the given time in milliseconds using interrupts.
+ *              A time that does not fit the 24-bit reload is made of several equal timer periods,
+ *              the subscribers count the last one only.
  *****************************************************************************************/
 
 void SysTick_Init(uint16 a_TimeInMilliSeconds);
 
 /*****************************************************************************************
- * Function Name: SysTick_StartBusyWait
- * Parameters (in): a_TimeInMilliSeconds - Time in milliseconds for the delay
+ * Function Name: SysTick_SetClockFrequency
+ * Parameters (in): a_ClockHz - System clock frequency in Hz
  * Parameters (out): None
  * Return value: None
- * Description: Starts SysTick in busy-wait mode for the specified time in milliseconds.
+ * Description: Sets the clock the reload values are computed from, to be called after the
+ *              system clock is changed (PLL) and before SysTick_Init.
  *****************************************************************************************/
 
-void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds);
+void SysTick_SetClockFrequency(uint32 a_ClockHz);
 
 /*****************************************************************************************
  * Function Name: SysTick_Handler
  * Parameters (in): None
  * Parameters (out): None
  * Return value: None
- * Description: SysTick interrupt handler that calls the callback function.
+ * Description: SysTick interrupt handler that calls the subscribers due in this period.
  *****************************************************************************************/
 
 void SysTick_Handler(void);
 
 /*****************************************************************************************
- * Service Name: SysTick_SetCallBack
- * Parameters (in): Ptr2Func - Pointer to the callback function
+ * Service Name: SysTick_AddSubscriber
+ * Parameters (in): a_Ptr2Func - Pointer to the callback function
+ *                  a_Divisor - Number of SysTick periods between two calls (1 .. 65535)
  * Parameters (out): None
- * Return value: None
- * Description: Sets the callback function to be called in the SysTick interrupt.
+ * Return value: TRUE if added, FALSE if NULL_PTR, already added, a_Divisor is 0 or the table is full
+ * Description: Adds a function called in the SysTick interrupt every a_Divisor periods,
+ *              up to SYSTICK_MAX_SUBSCRIBERS functions. Safe against the interrupt.
+ *****************************************************************************************/
+
+boolean SysTick_AddSubscriber(void (*a_Ptr2Func)(void), uint16 a_Divisor);
+
+/*****************************************************************************************
+ * Service Name: SysTick_RemoveSubscriber
+ * Parameters (in): a_Ptr2Func - Pointer to the callback function added by SysTick_AddSubscriber
+ * Parameters (out): None
+ * Return value: TRUE if removed, FALSE if it is not a subscriber
+ * Description: Stops calling a function in the SysTick interrupt. Safe against the interrupt.
  *****************************************************************************************/
 
-void SysTick_SetCallBack(volatile void (*Ptr2Func)(void));
+boolean SysTick_RemoveSubscriber(void (*a_Ptr2Func)(void));
 
 /*****************************************************************************************
  * Function Name: SysTick_Stop
@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Module: Timing
+ *
+ * File Name: Timing.c
+ *
+ * Description: Source file for the cycle-accurate delays and time measurement
+ *              on the ARM Cortex M4 DWT cycle counter (CYCCNT)
+ *
+ * Author: Zeyad Hisham Elsayed
+ *
+ *******************************************************************************/
+
+#include "Timing.h"
+
+#ifdef TIMING_HOST_BUILD
+/* The virtual counter must wrap at 2^32 like CYCCNT (std_types.h makes uint32 32-bit in the host build) */
+typedef char Timing_HostUint32Check[(sizeof(uint32) == 4) ? 1 : -1];
+
+/* Virtual cycle counter of the host build */
+static uint32 g_TimingVirtualCycles = 0;
+#else
+#include "../../tm4c123gh6pm_registers.h"
+#endif
+
+/* Core cycles in 1 us and in 1 ms, set by Timing_Init */
+static uint32 g_TimingCyclesPerUs = 16;
+static uint32 g_TimingCyclesPerMs = 16000;
+
+/*******************************************************************************
+ *                              Functions Definitions                          *
+ *******************************************************************************/
+
+/*****************************************************************************************
+ * Function Name: Timing_WaitUntil
+ * Parameters (in): a_Deadline - Counter value to reach (less than 2^31 cycles ahead)
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits until the counter passes the deadline.
+ *****************************************************************************************/
+static void Timing_WaitUntil(uint32 a_Deadline)
+{
+    while((sint32)(Timing_GetCycles() - a_Deadline) < 0);
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_Init
+ * Parameters (in): a_ClockHz - System clock frequency in Hz (multiple of 1 MHz)
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enables the DWT cycle counter, it counts the core clock and wraps every 2^32 cycles.
+ *****************************************************************************************/
+void Timing_Init(uint32 a_ClockHz)
+{
+    g_TimingCyclesPerUs = a_ClockHz / 1000000;
+    g_TimingCyclesPerMs = a_ClockHz / 1000;
+
+#ifndef TIMING_HOST_BUILD
+    DEMCR_REG      |= TIMING_TRCENA_MASK;       /* Power the DWT unit */
+    DWT_LAR_REG     = TIMING_DWT_UNLOCK_KEY;    /* Unlock the DWT registers (ignored where not implemented) */
+    DWT_CYCCNT_REG  = 0;
+    DWT_CTRL_REG   |= TIMING_CYCCNTENA_MASK;    /* Start counting the core clock */
+#endif
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_GetCycles
+ * Parameters (in): None
+ * Parameters (out): None
+ * Return value: Current value of the cycle counter
+ * Description: Reads the cycle counter, the unsigned difference of two readings is wrap safe.
+ *****************************************************************************************/
+uint32 Timing_GetCycles(void)
+{
+#ifdef TIMING_HOST_BUILD
+    g_TimingVirtualCycles += TIMING_HOST_CYCLES_PER_READ;
+    return g_TimingVirtualCycles;
+#else
+    return DWT_CYCCNT_REG;
+#endif
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_GetElapsedCycles
+ * Parameters (in): a_StartCycles - Reading of Timing_GetCycles at the start of the measurement
+ * Parameters (out): None
+ * Return value: Cycles elapsed since a_StartCycles (less than 2^32)
+ * Description: Measures the execution time of a code section.
+ *****************************************************************************************/
+uint32 Timing_GetElapsedCycles(uint32 a_StartCycles)
+{
+    return Timing_GetCycles() - a_StartCycles;
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_CyclesToUs
+ * Parameters (in): a_Cycles - Number of core cycles
+ * Parameters (out): None
+ * Return value: Time of the cycles in us (rounded down)
+ * Description: Converts a measured number of cycles to us.
+ *****************************************************************************************/
+uint32 Timing_CyclesToUs(uint32 a_Cycles)
+{
+    return a_Cycles / g_TimingCyclesPerUs;
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayCycles
+ * Parameters (in): a_Cycles - Cycles to wait
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits at least the given cycles, at most one polling iteration more
+ *              whatever the compiler and optimization level.
+ *****************************************************************************************/
+void Timing_DelayCycles(uint32 a_Cycles)
+{
+    uint32 deadline = Timing_GetCycles();
+
+    /* A wait longer than 2^31 cycles is done in two steps */
+    if(a_Cycles > TIMING_MAX_WAIT_CYCLES)
+    {
+        deadline += TIMING_MAX_WAIT_CYCLES;
+        Timing_WaitUntil(deadline);
+        a_Cycles -= TIMING_MAX_WAIT_CYCLES;
+    }
+    Timing_WaitUntil(deadline + a_Cycles);
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayUs
+ * Parameters (in): a_TimeInMicroSeconds - Time to wait in us
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits the given time counted in core cycles.
+ *****************************************************************************************/
+void Timing_DelayUs(uint32 a_TimeInMicroSeconds)
+{
+    uint32 deadline = Timing_GetCycles();
+    uint32 ms = a_TimeInMicroSeconds / 1000;
+
+    /* Whole ms first so the deadline never gets more than 2^31 cycles ahead */
+    while(ms--)
+    {
+        deadline += g_TimingCyclesPerMs;
+        Timing_WaitUntil(deadline);
+    }
+    Timing_WaitUntil(deadline + ((a_TimeInMicroSeconds % 1000) * g_TimingCyclesPerUs));
+}
+
+/*****************************************************************************************
+ * Function Name: Timing_DelayMs
+ * Parameters (in): a_TimeInMilliSeconds - Time to wait in ms
+ * Parameters (out): None
+ * Return value: None
+ * Description: Busy-waits the given time counted in core cycles, any length without drift.
+ *****************************************************************************************/
+void Timing_DelayMs(uint32 a_TimeInMilliSeconds)
+{
+    uint32 deadline = Timing_GetCycles();
+
+    /* Every ms ends on its own deadline, the polling overshoot does not add up */
+    while(a_TimeInMilliSeconds--)
+    {
+        deadline += g_TimingCyclesPerMs;
+        Timing_WaitUntil(deadline);
+    }
+}
+
+#ifdef TIMING_HOST_BUILD
+/*****************************************************************************************
+ * Function Name: Timing_HostAdvance
+ * Parameters (in): a_Cycles - Virtual cycles spent
+ * Parameters (out): None
+ * Return value: None
+ * Description: Host build only ... moves the virtual clock as if the core ran the cycles.
+ *****************************************************************************************/
+void Timing_HostAdvance(uint32 a_Cycles)
+{
+    g_TimingVirtualCycles += a_Cycles;
+}
+#endif
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Module: Timing
+ *
+ * File Name: Timing_HostTest.c
+ *
+ * Description: Host test of the Timing module on its virtual 32-bit cycle counter,
+ *              checks the delays and the elapsed time measurement across a counter wrap.
+ *
+ *              Build and run from this folder:
+ *                  gcc -std=c99 -Wall -DTIMING_HOST_BUILD -I../Applications/Application_1/MCAL/Timing Timing_HostTest.c \
+ *                      ../Applications/Application_1/MCAL/Timing/Timing.c -o Timing_HostTest
+ *                  ./Timing_HostTest
+ *
+ * Author: Zeyad Hisham Elsayed
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "Timing.h"
+
+#define TEST_CLOCK_HZ                        16000000
+#define TEST_CYCLES_PER_MS                   (TEST_CLOCK_HZ / 1000)
+
+/* A wait ends on the first reading past its deadline, one reading more is the measurement */
+#define TEST_MAX_OVERSHOOT                   (2 * TIMING_HOST_CYCLES_PER_READ)
+
+static uint32 g_Failures = 0;
+
+/* Check a measured wait is at least the requested cycles and at most the polling overshoot more */
+static void Test_CheckWait(const char *a_Name, uint32 a_Measured, uint32 a_Expected)
+{
+    if((a_Measured < a_Expected) || (a_Measured > (a_Expected + TEST_MAX_OVERSHOOT)))
+    {
+        printf("FAIL %-40s measured %u expected %u\n", a_Name, (unsigned)a_Measured, (unsigned)a_Expected);
+        g_Failures++;
+    }
+    else
+    {
+        printf("PASS %-40s measured %u\n", a_Name, (unsigned)a_Measured);
+    }
+}
+
+/* Move the virtual counter to a given distance before its wrap */
+static void Test_MoveBeforeWrap(uint32 a_Cycles)
+{
+    Timing_HostAdvance((0 - a_Cycles) - Timing_GetCycles());
+}
+
+int main(void)
+{
+    uint32 start;
+
+    Timing_Init(TEST_CLOCK_HZ);
+
+    /* Elapsed time over the wrap */
+    Test_MoveBeforeWrap(100);
+    start = Timing_GetCycles();
+    Timing_HostAdvance(1000);
+    Test_CheckWait("Timing_GetElapsedCycles across the wrap", Timing_GetElapsedCycles(start), 1000);
+
+    /* Short delay ending after the wrap */
+    Test_MoveBeforeWrap(1000);
+    start = Timing_GetCycles();
+    Timing_DelayCycles(5000);
+    Test_CheckWait("Timing_DelayCycles(5000) across the wrap", Timing_GetElapsedCycles(start), 5000);
+    if(Timing_GetCycles() > start)
+    {
+        printf("FAIL %-40s the counter did not wrap\n", "Timing_DelayCycles(5000) across the wrap");
+        g_Failures++;
+    }
+
+    /* Delay longer than 2^31 cycles, done in two steps */
+    Test_MoveBeforeWrap(1000);
+    start = Timing_GetCycles();
+    Timing_DelayCycles(3000000000U);
+    Test_CheckWait("Timing_DelayCycles(3000000000) over the wrap", Timing_GetElapsedCycles(start), 3000000000U);
+
+    /* Every ms ends on its own deadline ... the overshoot does not add up */
+    Test_MoveBeforeWrap(TEST_CYCLES_PER_MS / 2);
+    start = Timing_GetCycles();
+    Timing_DelayMs(10);
+    Test_CheckWait("Timing_DelayMs(10) across the wrap", Timing_GetElapsedCycles(start), 10 * TEST_CYCLES_PER_MS);
+
+    /* Longer than the 268 s wrap period of the counter at 16 MHz */
+    start = Timing_GetCycles();
+    Timing_DelayMs(300000);
+    Test_CheckWait("Timing_DelayMs(300000) longer than a wrap", Timing_GetElapsedCycles(start) - (uint32)(300000ULL * TEST_CYCLES_PER_MS), 0);
+
+    Test_MoveBeforeWrap(10);
+    start = Timing_GetCycles();
+    Timing_DelayUs(1500);
+    Test_CheckWait("Timing_DelayUs(1500) across the wrap", Timing_GetElapsedCycles(start), 1500 * (TEST_CLOCK_HZ / 1000000));
+
+    printf("%u failure(s)\n", (unsigned)g_Failures);
+    return (g_Failures == 0) ? 0 : 1;
+}
@@ -15,6 +15,8 @@
 #include "Dio.h"
 #include "Mcu.h"
 #include "Port.h"
+#include "Gpt.h"
+#include "Os.h"
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
@@ -23,9 +25,19 @@ void Init_Task(void)
     Port_Init(&Pins_configuration);
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+    /* Initialize Gpt Driver ... the channels stay stopped until Gpt_StartTimer */
+    Gpt_Init(&Gpt_Configuration);
+    /* The button edges activate the App Task from now on */
+    Button_EnableEdgeInterrupt();
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Called by the button edge interrupt (or the debounce polling) on a change, the App Task reacts within us */
+void App_ButtonChangeNotification(void)
+{
+    (void)Os_SetEvent(OsConf_APP_TASK_ID_INDEX);
+}
+
+/* Description: Task executes every 20 Mili-seconds to debounce the button and enable its edge interrupt again */
 void Button_Task(void)
 {
     Button_RefreshState();
@@ -34,10 +46,12 @@ void Button_Task(void)
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void)
 {
+    (void)Os_GetResource(OsConf_LED_RESOURCE_ID_INDEX);
     Led_RefreshOutput();
+    (void)Os_ReleaseResource(OsConf_LED_RESOURCE_ID_INDEX);
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the button edge interrupt when the button state changes to get the button status and toggle the led */
 void App_Task(void)
 {
     static uint8 button_previous_state = BUTTON_RELEASED;
@@ -50,8 +64,21 @@ void App_Task(void)
     if ((button_current_state == BUTTON_PRESSED)
             && (button_previous_state == BUTTON_RELEASED))
     {
+        (void)Os_GetResource(OsConf_LED_RESOURCE_ID_INDEX);
         Led_Toggle();
+        (void)Os_ReleaseResource(OsConf_LED_RESOURCE_ID_INDEX);
     }
 
     button_previous_state = button_current_state;
 }
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/* Description: Called when a task exceeds its execution budget ... stop it, the next release starts it again */
+Os_ProtectionActionType Os_ProtectionHook(Os_TaskType TaskId)
+{
+    /* Same action for every task, the Os already reported the violation to the Det */
+    (void)TaskId;
+
+    return OS_PRO_TERMINATE_TASK;
+}
+#endif
@@ -17,13 +17,13 @@
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to debounce the button and enable its edge interrupt again */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the button edge interrupt when the button state changes to get the button status and toggle the led */
 void App_Task(void);
 
 #endif /* APP_H_ */
@@ -11,12 +11,21 @@
 #include "Dio.h"
 #include "Port.h"
 #include "Button.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* GPIO Port F is interrupt 30, its priority is in the bits 21 .. 23 of NVIC_PRI7 */
+#define BUTTON_PORTF_IRQ_NUM        30
+#define BUTTON_PRIORITY_MASK        0xFF1FFFFF
+#define BUTTON_PRIORITY_BITS_POS    21
 
 /* Button Configurations Structure */
 /*static Port_ConfigType g_Button_Config;*/
 
-/* Global variable to hold the button state */
-static uint8 g_button_state = BUTTON_RELEASED;
+/* Global variable to hold the button state ... changed by the edge interrupt and by the polling */
+static volatile uint8 g_button_state = BUTTON_RELEASED;
+
+/* TRUE while the edge interrupt is masked until the pin settles */
+static volatile boolean g_Edge_Locked = FALSE;
 
 /*******************************************************************************************************************/
 /* Description: Called by the Button_Init function (only) used to fill the Button configurations structure */
@@ -37,6 +46,31 @@ static void Button_FillConfigurations(void)
     Port_SetupGpioPin(&g_Button_Config);
 }
 */
+/*******************************************************************************************************************/
+void Button_EnableEdgeInterrupt(void)
+{
+    GPIO_PORTF_IS_REG  &= ~(1UL << BUTTON_PIN_NUM);     /* Detect edges */
+    GPIO_PORTF_IBE_REG |=  (1UL << BUTTON_PIN_NUM);     /* Detect both the press and the release edges */
+    GPIO_PORTF_ICR_REG  =  (1UL << BUTTON_PIN_NUM);     /* Clear an edge detected before */
+    GPIO_PORTF_IM_REG  |=  (1UL << BUTTON_PIN_NUM);     /* Enable the interrupt of the button pin */
+
+    NVIC_PRI7_REG = (NVIC_PRI7_REG & BUTTON_PRIORITY_MASK) | (BUTTON_INTERRUPT_PRIORITY << BUTTON_PRIORITY_BITS_POS);
+    NVIC_EN0_REG  = (1UL << BUTTON_PORTF_IRQ_NUM);
+}
+
+/*******************************************************************************************************************/
+void Button_PortF_Isr(void)
+{
+    /* Ignore the bounces of this edge, Button_RefreshState enables the interrupt again */
+    GPIO_PORTF_IM_REG &= ~(1UL << BUTTON_PIN_NUM);
+    GPIO_PORTF_ICR_REG = (1UL << BUTTON_PIN_NUM);
+    g_Edge_Locked = TRUE;
+
+    /* The edge leaves the current state, the pin level may still bounce */
+    g_button_state = (g_button_state == BUTTON_PRESSED) ? BUTTON_RELEASED : BUTTON_PRESSED;
+    BUTTON_CHANGE_NOTIFICATION();
+}
+
 /*******************************************************************************************************************/
 uint8 Button_GetState(void)
 {
@@ -48,34 +82,41 @@ void Button_RefreshState(void)
 {
     uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
 
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
+    /* Count the samples equal to and different from the button state while the edge interrupt is masked */
+    static uint8 g_Stable_Count  = 0;
+    static uint8 g_Changed_Count = 0;
 
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
+    /* The edge interrupt is enabled ... it reports the next change */
+    if(g_Edge_Locked == FALSE)
+    {
+        return;
+    }
 
-    if(state == BUTTON_PRESSED)
+    if(state == g_button_state)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        g_Stable_Count++;
+        g_Changed_Count = 0;
     }
     else
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        g_Changed_Count++;
+        g_Stable_Count = 0;
     }
 
-    if(g_Pressed_Count == 3)
+    if(g_Changed_Count == BUTTON_DEBOUNCE_SAMPLES)
     {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
+        /* Changed back while masked (a glitch or a short press), take it as a debounced change */
+        g_button_state  = state;
+        g_Changed_Count = 0;
+        BUTTON_CHANGE_NOTIFICATION();
     }
-    else if(g_Released_Count == 3)
+    else if(g_Stable_Count == BUTTON_DEBOUNCE_SAMPLES)
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        /* The pin settled, enable the interrupt for the next edge */
+        g_Stable_Count = 0;
+        g_Edge_Locked  = FALSE;
+        GPIO_PORTF_ICR_REG = (1UL << BUTTON_PIN_NUM);
+        GPIO_PORTF_IM_REG |= (1UL << BUTTON_PIN_NUM);
     }
 }
 /*******************************************************************************************************************/
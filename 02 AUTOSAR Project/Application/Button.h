@@ -21,14 +21,27 @@
  */
 void Button_init();
 
+/*
+ * Description: Enable the interrupt on both edges of the button pin (GPIO Port F),
+ *              the pin itself is configured by Port_Init
+ */
+void Button_EnableEdgeInterrupt(void);
+
 /* Description: Read the Button state Pressed/Released */
 uint8 Button_GetState(void);
 
 /* 
- * Description: This function is called every 20ms by Os Task and it responsible for Updating 
- *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
- *		        and it should be in a RELEASED State if the button is released for 60ms.
+ * Description: This function is called every 20ms by Os Task and it is responsible for the debounce only.
+ *              The first edge changes the BUTTON State at once (Button_PortF_Isr) and masks the edge interrupt,
+ *              it is enabled again once the pin kept the new state for BUTTON_DEBOUNCE_SAMPLES samples.
+ *              A change missed while masked is taken after BUTTON_DEBOUNCE_SAMPLES equal samples.
  */   
 void Button_RefreshState(void);
 
+/* Description: GPIO Port F interrupt ... toggle the BUTTON State on the first edge and notify the change */
+void Button_PortF_Isr(void);
+
+/* Description: Provided by the application, called on every change of the BUTTON State */
+void BUTTON_CHANGE_NOTIFICATION(void);
+
 #endif /* BUTTON_H */
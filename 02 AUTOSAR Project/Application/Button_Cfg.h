@@ -22,5 +22,14 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Number of equal 20 ms samples before the polled pin level is trusted (debounce) */
+#define BUTTON_DEBOUNCE_SAMPLES     (3U)
+
+/* NVIC priority of the GPIO Port F edge interrupt of the button (0 .. 7, lower value is higher priority) */
+#define BUTTON_INTERRUPT_PRIORITY   (5U)
+
+/* Function called when the button state changes, from the edge interrupt or from Button_RefreshState */
+#define BUTTON_CHANGE_NOTIFICATION  App_ButtonChangeNotification
+
 
 #endif /* BUTTON_CFG_H_ */
@@ -11,6 +11,13 @@
 
 #include "Det.h"
 
+/* Last runtime error reported and number of runtime errors since reset */
+static volatile uint16 g_Det_Runtime_Module_Id = 0;
+static volatile uint8 g_Det_Runtime_Instance_Id = 0;
+static volatile uint8 g_Det_Runtime_Api_Id = 0;
+static volatile uint8 g_Det_Runtime_Error_Id = 0;
+static volatile uint32 g_Det_Runtime_Errors = 0;
+
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
@@ -23,3 +30,15 @@ Std_ReturnType Det_ReportError( uint16 ModuleId,
     return E_OK;
 }
 
+Std_ReturnType Det_ReportRuntimeError( uint16 ModuleId,
+                                       uint8 InstanceId,
+                                       uint8 ApiId,
+                                       uint8 ErrorId )
+{
+    g_Det_Runtime_Module_Id = ModuleId;
+    g_Det_Runtime_Instance_Id = InstanceId;
+    g_Det_Runtime_Api_Id = ApiId;
+    g_Det_Runtime_Error_Id = ErrorId;
+    g_Det_Runtime_Errors++;
+    return E_OK;
+}
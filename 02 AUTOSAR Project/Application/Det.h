@@ -54,4 +54,10 @@ Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 ApiId,
                                 uint8 ErrorId );
 
+/* Runtime errors are recorded and the execution continues (the last one and the count are kept for the debugger) */
+Std_ReturnType Det_ReportRuntimeError( uint16 ModuleId,
+                                       uint8 InstanceId,
+                                       uint8 ApiId,
+                                       uint8 ErrorId );
+
 #endif /* DET_H */
@@ -4,21 +4,124 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver.
+ *              SysTick Timer (Os tick), Timer0A (Os timing protection) and the Gpt channels
+ *              on the 16/32-bit and 32/64-bit General-Purpose Timer blocks.
  *
  * Author: Zeyad Hisham
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Gpt_Regs.h"
 #include "tm4c123gh6pm_registers.h"
 
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#define REGISTER(BASE,OFFSET) *(volatile uint32*)((volatile uint8*)(BASE) + (OFFSET))
+
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
+#define SYSTICK_ENABLE_MASK         0x00000001
+#define SYSTICK_PENDSTSET_MASK      0x04000000
+
+#define GPT_TAEN_MASK               0x00000001
+#define GPT_TATO_MASK               0x00000001      /* Time-out interrupt bit in IMR, RIS and ICR */
+#define GPT_CONFIG_32_BIT           0x00000000      /* 16/32-bit block concatenated, 32/64-bit block concatenated */
+#define GPT_CONFIG_WIDE_32_BIT      0x00000004      /* 32/64-bit block split in two 32-bit timers with prescaler */
+#define GPT_ONE_SHOT_MODE           0x00000001
+#define GPT_PERIODIC_MODE           0x00000002
+#define GPT_PRIORITY_BITS_POS       5               /* Priority in the upper 3 bits of the NVIC priority byte */
+#define GPT_MAX_PRIORITY            7
+#define GPT_WIDE_TIMER_MAX_PRESCALER 0xFFFF
+
+#define TIMER0A_INTERRUPT_PRIORITY  0
+
+/* Channel states */
+#define GPT_CHANNEL_STOPPED         (0U)            /* Initialized or stopped by Gpt_StopTimer */
+#define GPT_CHANNEL_RUNNING         (1U)
+#define GPT_CHANNEL_EXPIRED         (2U)            /* One-shot channel that reached its target time */
+
+/* Base address and time-out interrupt number (timer A) of every General-Purpose Timer block */
+static const uint32 g_Gpt_Base_Address[GPT_HW_TIMERS_NUM] = {
+    GPT_TIMER0_BASE_ADDRESS,  GPT_TIMER1_BASE_ADDRESS,  GPT_TIMER2_BASE_ADDRESS,
+    GPT_TIMER3_BASE_ADDRESS,  GPT_TIMER4_BASE_ADDRESS,  GPT_TIMER5_BASE_ADDRESS,
+    GPT_WTIMER0_BASE_ADDRESS, GPT_WTIMER1_BASE_ADDRESS, GPT_WTIMER2_BASE_ADDRESS,
+    GPT_WTIMER3_BASE_ADDRESS, GPT_WTIMER4_BASE_ADDRESS, GPT_WTIMER5_BASE_ADDRESS
+};
+static const uint8 g_Gpt_Irq[GPT_HW_TIMERS_NUM] = {19, 21, 23, 35, 70, 92, 94, 96, 98, 100, 102, 104};
+
+/* Channel served by every block, GPT_NO_CHANNEL for a block without channel */
+#define GPT_NO_CHANNEL              (0xFFU)
+static Gpt_ChannelType g_Gpt_Hw_Channel[GPT_HW_TIMERS_NUM];
+
+static const Gpt_ConfigChannel * g_Gpt_Channels = NULL_PTR;
+static uint8 g_Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* State, target time and elapsed time at the last Gpt_StopTimer of every channel */
+static volatile uint8 g_Gpt_Channel_State[GPT_CONFIGURED_CHANNELS];
+static Gpt_ValueType g_Gpt_Target[GPT_CONFIGURED_CHANNELS];
+static Gpt_ValueType g_Gpt_Stop_Elapsed[GPT_CONFIGURED_CHANNELS];
+static volatile boolean g_Gpt_Notification_Enabled[GPT_CONFIGURED_CHANNELS];
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+/* Timer counts lost while the SysTick Timer is stopped to be reprogrammed in SysTick_AdjustTimeRemaining */
+#define SYSTICK_ADJUST_COMPENSATION 8
+
+/* Reload value of the normal SysTick period set by SysTick_Start */
+static uint32 g_SysTick_Reload = 0;
+
+/*
+ * Timer periods making one SysTick_Start period and timer periods left in the current one,
+ * more than 1 only for a period that does not fit the 24-bit reload
+ */
+static uint16 g_SysTick_Chain_Length = 1;
+static uint16 g_SysTick_Chain_Count = 1;
+
+/*
+ * SysTick subscribers ... each one is called every Divisor periods when its Countdown reaches 0,
+ * a free entry has a NULL_PTR Callback. Only the entries below g_SysTick_Subscribers_End are scanned.
+ */
+typedef struct
+{
+    void (*volatile Callback)(void);
+    uint16 Divisor;
+    uint16 Countdown;
+} SysTick_SubscriberType;
+
+static SysTick_SubscriberType g_SysTick_Subscribers[SYSTICK_MAX_SUBSCRIBERS];
+static volatile uint8 g_SysTick_Subscribers_End = 0;
+
+/* Mask the interrupts and return the previous PRIMASK */
+uint32 SysTick_EnterCritical(void);
+
+/* Restore a PRIMASK value */
+void SysTick_ExitCritical(uint32 Primask);
+
+__asm("        .thumb                          \n"
+      "        .global SysTick_EnterCritical   \n"
+      "        .global SysTick_ExitCritical    \n"
+      "SysTick_EnterCritical:                  \n"
+      "        MRS      R0, PRIMASK            \n"
+      "        CPSID    I                      \n"
+      "        BX       LR                     \n"
+      "SysTick_ExitCritical:                   \n"
+      "        MSR      PRIMASK, R0            \n"
+      "        BX       LR                     \n");
+
+#if (SYSTICK_OS_TICK_DIRECT_CALL == STD_ON)
+/* Os tick function called directly by the ISR */
+extern void SYSTICK_OS_TICK_FUNCTION(void);
+#endif
 
 /************************************************************************************
 * Service Name: SysTick_Handler
@@ -26,10 +129,30 @@ static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    uint8 index;
+    void (*callback)(void);
+
+    /* Notify on the last timer period of a chained period only */
+    if(--g_SysTick_Chain_Count != 0)
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        return;
+    }
+    g_SysTick_Chain_Count = g_SysTick_Chain_Length;
+
+#if (SYSTICK_OS_TICK_DIRECT_CALL == STD_ON)
+    /* Direct call ... no pointer load, NULL check or indirect branch before the Os tick */
+    SYSTICK_OS_TICK_FUNCTION();
+#endif
+
+    /* A count down per subscriber ... no division on the tick path */
+    for(index = 0; index < g_SysTick_Subscribers_End; index++)
+    {
+        callback = g_SysTick_Subscribers[index].Callback;
+        if((callback != NULL_PTR) && (--g_SysTick_Subscribers[index].Countdown == 0))
+        {
+            g_SysTick_Subscribers[index].Countdown = g_SysTick_Subscribers[index].Divisor;
+            callback();
+        }
     }
     /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
 }
@@ -43,14 +166,29 @@ void SysTick_Handler(void)
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the system clock given by Mcu_GetSysClockFrequency
+*              - Chain several equal timer periods when n miliseconds do not fit the 24-bit reload
+*              - Enable SysTick Timer with System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
+    /* Clock counts of the requested period ... up to 65535 ms at 80 MHz needs more than 32 bits */
+    uint64 counts = (uint64)(Mcu_GetSysClockFrequency() / 1000U) * Tick_Time;
+    uint16 chain;
+
+    /* Fewest timer periods of the same length that fit the reload register, Tick_Time periods of 1 ms always do */
+    chain = (uint16)((counts + SYSTICK_MAX_RELOAD_VALUE) / (SYSTICK_MAX_RELOAD_VALUE + 1U));
+    while((chain == 0) || ((counts % chain) != 0))
+    {
+        chain++;
+    }
+
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
+    g_SysTick_Reload    = (uint32)(counts / chain) - 1U;
+    g_SysTick_Chain_Length = chain;
+    g_SysTick_Chain_Count  = chain;
+    SYSTICK_RELOAD_REG  = g_SysTick_Reload;          /* Set the Reload value to count n miliseconds */
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
@@ -77,16 +215,807 @@ void SysTick_Stop(void)
 }
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_AddSubscriber
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
 * Parameters (in): Ptr2Func - Call Back function address
+*                  Divisor - Number of SysTick periods between two calls (1 .. 65535)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is added
+*                                E_NOT_OK if it is NULL_PTR or already added, the Divisor is 0 or the table is full
+* Description: Function to add a function called from the SysTick ISR every Divisor periods,
+*              the first call is Divisor periods after this one. Safe against the ISR and
+*              can be called from any context, the table is updated with the interrupts masked.
+************************************************************************************/
+Std_ReturnType SysTick_AddSubscriber(void (*Ptr2Func)(void), uint16 Divisor)
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint8 index;
+    uint8 free_index = SYSTICK_MAX_SUBSCRIBERS;
+    uint32 primask;
+
+    if((Ptr2Func != NULL_PTR) && (Divisor != 0))
+    {
+        primask = SysTick_EnterCritical();
+
+        for(index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++)
+        {
+            if(g_SysTick_Subscribers[index].Callback == Ptr2Func)
+            {
+                /* Already added ... removal by function address must stay unambiguous */
+                free_index = SYSTICK_MAX_SUBSCRIBERS;
+                break;
+            }
+            else if((g_SysTick_Subscribers[index].Callback == NULL_PTR) && (free_index == SYSTICK_MAX_SUBSCRIBERS))
+            {
+                free_index = index;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+
+        if(free_index != SYSTICK_MAX_SUBSCRIBERS)
+        {
+            /* The Callback is written last, the entry is complete when the ISR sees it */
+            g_SysTick_Subscribers[free_index].Divisor   = Divisor;
+            g_SysTick_Subscribers[free_index].Countdown = Divisor;
+            g_SysTick_Subscribers[free_index].Callback  = Ptr2Func;
+            if(free_index >= g_SysTick_Subscribers_End)
+            {
+                g_SysTick_Subscribers_End = free_index + 1;
+            }
+            status = E_OK;
+        }
+
+        SysTick_ExitCritical(primask);
+    }
+
+    return status;
+}
+
+/************************************************************************************
+* Service Name: SysTick_RemoveSubscriber
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Ptr2Func - Call Back function address added by SysTick_AddSubscriber
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is removed
+*                                E_NOT_OK if it is not a subscriber
+* Description: Function to stop calling a function from the SysTick ISR. Safe against the ISR,
+*              the function is not called after the return unless the removal preempted
+*              the SysTick ISR (then it can be called once more when the ISR resumes).
+************************************************************************************/
+Std_ReturnType SysTick_RemoveSubscriber(void (*Ptr2Func)(void))
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint8 index;
+    uint32 primask;
+
+    if(Ptr2Func != NULL_PTR)
+    {
+        primask = SysTick_EnterCritical();
+
+        for(index = 0; index < g_SysTick_Subscribers_End; index++)
+        {
+            if(g_SysTick_Subscribers[index].Callback == Ptr2Func)
+            {
+                g_SysTick_Subscribers[index].Callback = NULL_PTR;
+                status = E_OK;
+                break;
+            }
+        }
+
+        /* Shrink the scanned range over the free entries at its end */
+        while((g_SysTick_Subscribers_End > 0) && (g_SysTick_Subscribers[g_SysTick_Subscribers_End - 1].Callback == NULL_PTR))
+        {
+            g_SysTick_Subscribers_End--;
+        }
+
+        SysTick_ExitCritical(primask);
+    }
+
+    return status;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeElapsed
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts elapsed since the last SysTick interrupt
+* Description: Function to read how far the SysTick Timer is in the current period.
+*              Elapsed + Remaining time is always equal to the reload value (period - 1),
+*              the elapsed time is not valid during a period changed by SysTick_AdjustTimeRemaining.
+************************************************************************************/
+uint32 SysTick_GetTimeElapsed(void)
+{
+    return (SYSTICK_RELOAD_REG - SYSTICK_CURRENT_REG);
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeRemaining
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts remaining until the next SysTick interrupt
+* Description: Function to read the SysTick Timer current (down counting) value.
+************************************************************************************/
+uint32 SysTick_GetTimeRemaining(void)
+{
+    return SYSTICK_CURRENT_REG;
+}
+
+/************************************************************************************
+* Service Name: SysTick_IsInterruptPending
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the SysTick interrupt is pending and not served yet
+* Description: Function to check if the SysTick Timer expired while its interrupt is masked.
+************************************************************************************/
+boolean SysTick_IsInterruptPending(void)
+{
+    return ((NVIC_SYSTEM_INTCTRL & SYSTICK_PENDSTSET_MASK) != 0) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+* Service Name: SysTick_AdjustTimeRemaining
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): Delta - Timer counts to add to (or remove from) the current period
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the current period is adjusted
+*                                E_NOT_OK if the timer already expired or the result does not fit 24 bits
+* Description: Function to lengthen or shorten the current SysTick period only, the periods
+*              after it use the reload value set by SysTick_Start again.
+*              The counts spent while the timer is stopped are compensated so no drift is added.
+*              Should be called with the interrupts masked.
+************************************************************************************/
+Std_ReturnType SysTick_AdjustTimeRemaining(sint32 Delta)
+{
+    Std_ReturnType status = E_NOT_OK;
+    sint32 new_reload;
+
+    SYSTICK_CTRL_REG &= ~SYSTICK_ENABLE_MASK;        /* Freeze the counter while reprogramming */
+    new_reload = (sint32)SYSTICK_CURRENT_REG + Delta - SYSTICK_ADJUST_COMPENSATION;
+
+    if((SysTick_IsInterruptPending() == FALSE) && (new_reload > 0) && (new_reload <= SYSTICK_MAX_RELOAD_VALUE))
+    {
+        SYSTICK_RELOAD_REG  = (uint32)new_reload;    /* The current period ends after new_reload counts */
+        SYSTICK_CURRENT_REG = 0;                     /* Clear the counter to load the new value on the next clock */
+        SYSTICK_CTRL_REG   |= SYSTICK_ENABLE_MASK;
+        SYSTICK_RELOAD_REG  = g_SysTick_Reload;      /* Used from the next period, the counter already loaded new_reload */
+        status = E_OK;
+    }
+    else
+    {
+        SYSTICK_CTRL_REG   |= SYSTICK_ENABLE_MASK;   /* Continue the current period without changes */
+    }
+
+    return status;
+}
+
+/*********************************************************************************************/
+/* Description: Enable the clock of a General-Purpose Timer block and wait until its registers can be accessed */
+static void Gpt_EnableClock(Gpt_HwTimerType HwTimer)
+{
+    if(HwTimer < GPT_HW_WTIMER0)
+    {
+        SYSCTL_RCGCTIMER_REG |= (1UL << HwTimer);
+        while(!(SYSCTL_PRTIMER_REG & (1UL << HwTimer)));
+    }
+    else
+    {
+        SYSCTL_RCGCWTIMER_REG |= (1UL << (HwTimer - GPT_HW_WTIMER0));
+        while(!(SYSCTL_PRWTIMER_REG & (1UL << (HwTimer - GPT_HW_WTIMER0))));
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Set the priority of the time-out interrupt of a block then enable it in the NVIC */
+static void Gpt_EnableInterrupt(Gpt_HwTimerType HwTimer, uint8 Priority)
+{
+    uint8 irq = g_Gpt_Irq[HwTimer];
+
+    *((volatile uint8 *)GPT_NVIC_PRI_BASE_ADDRESS + irq) = (uint8)(Priority << GPT_PRIORITY_BITS_POS);
+    REGISTER(GPT_NVIC_EN_BASE_ADDRESS, (irq / 32U) * 4U) = (1UL << (irq % 32U));
+}
+
+/*********************************************************************************************/
+/* Description: Disable the time-out interrupt of a block in the NVIC and drop it if pending */
+static void Gpt_DisableInterrupt(Gpt_HwTimerType HwTimer)
+{
+    uint8 irq = g_Gpt_Irq[HwTimer];
+
+    REGISTER(GPT_NVIC_DIS_BASE_ADDRESS, (irq / 32U) * 4U)    = (1UL << (irq % 32U));
+    REGISTER(GPT_NVIC_UNPEND_BASE_ADDRESS, (irq / 32U) * 4U) = (1UL << (irq % 32U));
+}
+
+/************************************************************************************
+* Service Name: Timer0A_Init
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Setup Timer0A as a 32-bit one-shot down counter on the system clock:
+*              - Enable the Timer0 clock
+*              - Enable the time-out interrupt with the highest priority (0) so BASEPRI cannot mask it
+*              The timer is started later by Timer0A_StartOneShot.
+*              Timer 0 is reserved for the Os, Gpt_Init does not accept a channel on it.
+************************************************************************************/
+void Timer0A_Init(void)
+{
+    Gpt_EnableClock(GPT_HW_TIMER0);
+
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_CTL_REG_OFFSET)  &= ~GPT_TAEN_MASK;   /* Disable Timer0A while configuring it */
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_CFG_REG_OFFSET)   = GPT_CONFIG_32_BIT; /* 32-bit timer */
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_TAMR_REG_OFFSET)  = GPT_ONE_SHOT_MODE; /* One-shot mode counting down */
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_ICR_REG_OFFSET)   = GPT_TATO_MASK;     /* Clear any old time-out flag */
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_IMR_REG_OFFSET)  |= GPT_TATO_MASK;     /* Enable the time-out interrupt */
+
+    Gpt_EnableInterrupt(GPT_HW_TIMER0, TIMER0A_INTERRUPT_PRIORITY);
+}
+
+/************************************************************************************
+* Service Name: Timer0A_StartOneShot
+* Sync/Async: Asynchronous
+* Reentrancy: non reentrant
+* Parameters (in): Counts - Timer counts (system clock cycles) until the time-out interrupt
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to start Timer0A once, its interrupt vector is owned by the upper layer
+*              which calls Timer0A_ClearInterrupt.
 ************************************************************************************/
-void SysTick_SetCallBack(void(*Ptr2Func)(void))
+void Timer0A_StartOneShot(uint32 Counts)
 {
-    g_SysTick_Call_Back_Ptr = Ptr2Func;
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_CTL_REG_OFFSET)  &= ~GPT_TAEN_MASK;
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_TAILR_REG_OFFSET) = Counts;
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_CTL_REG_OFFSET)  |= GPT_TAEN_MASK;
+}
+
+/************************************************************************************
+* Service Name: Timer0A_Stop
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts that were remaining until the time-out
+* Description: Function to stop Timer0A and drop a pending time-out interrupt (0 remaining counts if it expired).
+************************************************************************************/
+uint32 Timer0A_Stop(void)
+{
+    uint32 remaining;
+
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_CTL_REG_OFFSET) &= ~GPT_TAEN_MASK;
+
+    /* Nothing remains once the time-out occurred */
+    remaining = (REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_RIS_REG_OFFSET) & GPT_TATO_MASK) ?
+                0 : REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_TAV_REG_OFFSET);
+
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+    REGISTER(GPT_NVIC_UNPEND_BASE_ADDRESS, 0) = (1UL << g_Gpt_Irq[GPT_HW_TIMER0]);
+
+    return remaining;
+}
+
+/************************************************************************************
+* Service Name: Timer0A_ClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the Timer0A time-out interrupt flag.
+************************************************************************************/
+void Timer0A_ClearInterrupt(void)
+{
+    REGISTER(GPT_TIMER0_BASE_ADDRESS, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+}
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+/*********************************************************************************************/
+/* Description: Report the errors common to the channel APIs, return TRUE if the call must be ignored */
+static boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ApiId)
+{
+    boolean error = FALSE;
+
+    /* Check if the Driver is initialized before using this function */
+    if(GPT_NOT_INITIALIZED == g_Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the used channel is within the valid range */
+    else if(GPT_CONFIGURED_CHANNELS <= Channel)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    return error;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Return the ticks elapsed in the current period of a running channel */
+static Gpt_ValueType Gpt_ReadElapsed(Gpt_ChannelType Channel)
+{
+    uint32 base = g_Gpt_Base_Address[g_Gpt_Channels[Channel].HwTimer];
+
+    /* A one-shot channel that expired before its interrupt is served */
+    if((GPT_CH_MODE_ONESHOT == g_Gpt_Channels[Channel].Mode) && (REGISTER(base, GPT_RIS_REG_OFFSET) & GPT_TATO_MASK))
+    {
+        return g_Gpt_Target[Channel];
+    }
+
+    /* The timer counts down from (target - 1) to 0 */
+    return (g_Gpt_Target[Channel] - 1U) - REGISTER(base, GPT_TAV_REG_OFFSET);
+}
+
+/*********************************************************************************************/
+/* Description: Time-out interrupt of a block, the one-shot channels stop by HW */
+static void Gpt_ServeHwTimer(Gpt_HwTimerType HwTimer)
+{
+    Gpt_ChannelType channel = g_Gpt_Hw_Channel[HwTimer];
+
+    REGISTER(g_Gpt_Base_Address[HwTimer], GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+
+    if(GPT_NO_CHANNEL == channel)
+    {
+        return;
+    }
+
+    if(GPT_CH_MODE_ONESHOT == g_Gpt_Channels[channel].Mode)
+    {
+        g_Gpt_Channel_State[channel] = GPT_CHANNEL_EXPIRED;
+    }
+
+    if((TRUE == g_Gpt_Notification_Enabled[channel]) && (NULL_PTR != g_Gpt_Channels[channel].Notification))
+    {
+        g_Gpt_Channels[channel].Notification();
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_TimerxA_Isr / Gpt_WideTimerxA_Isr
+* Description: General-Purpose Timer time-out ISRs (Timer 0 belongs to the Os timing protection)
+************************************************************************************/
+void Gpt_Timer1A_Isr(void)     { Gpt_ServeHwTimer(GPT_HW_TIMER1); }
+void Gpt_Timer2A_Isr(void)     { Gpt_ServeHwTimer(GPT_HW_TIMER2); }
+void Gpt_Timer3A_Isr(void)     { Gpt_ServeHwTimer(GPT_HW_TIMER3); }
+void Gpt_Timer4A_Isr(void)     { Gpt_ServeHwTimer(GPT_HW_TIMER4); }
+void Gpt_Timer5A_Isr(void)     { Gpt_ServeHwTimer(GPT_HW_TIMER5); }
+void Gpt_WideTimer0A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER0); }
+void Gpt_WideTimer1A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER1); }
+void Gpt_WideTimer2A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER2); }
+void Gpt_WideTimer3A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER3); }
+void Gpt_WideTimer4A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER4); }
+void Gpt_WideTimer5A_Isr(void) { Gpt_ServeHwTimer(GPT_HW_WTIMER5); }
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module:
+*              - Enable the clock of the timer block of every channel
+*              - Setup its mode, prescaler and time-out interrupt priority
+*              The channels are stopped and their notifications disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+    Gpt_ChannelType channel;
+    Gpt_HwTimerType hw_timer;
+    uint32 base;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if(NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else if(GPT_INITIALIZED == g_Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+        error = TRUE;
+    }
+    else
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            hw_timer = ConfigPtr->Channels[channel].HwTimer;
+            /* Timer 0 is reserved, only the wide timers have a prescaler in the 32-bit mode */
+            if((GPT_HW_TIMER0 == hw_timer) || (GPT_HW_TIMERS_NUM <= hw_timer)
+               || ((hw_timer < GPT_HW_WTIMER0) && (0U != ConfigPtr->Channels[channel].Prescaler))
+               || (GPT_MAX_PRIORITY < ConfigPtr->Channels[channel].Priority))
+            {
+                Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+                error = TRUE;
+                break;
+            }
+        }
+    }
+#endif
+
+    if(FALSE == error)
+    {
+        for(hw_timer = 0; hw_timer < GPT_HW_TIMERS_NUM; hw_timer++)
+        {
+            g_Gpt_Hw_Channel[hw_timer] = GPT_NO_CHANNEL;
+        }
+
+        /*
+         * Point to the PB configuration structure using a global pointer before any interrupt is enabled,
+         * this global pointer is global to be used by other functions to read the PB configuration structures
+         */
+        g_Gpt_Channels = ConfigPtr->Channels;
+
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            hw_timer = ConfigPtr->Channels[channel].HwTimer;
+            base     = g_Gpt_Base_Address[hw_timer];
+
+            g_Gpt_Channel_State[channel]        = GPT_CHANNEL_STOPPED;
+            g_Gpt_Target[channel]               = 0;
+            g_Gpt_Stop_Elapsed[channel]         = 0;
+            g_Gpt_Notification_Enabled[channel] = FALSE;
+            g_Gpt_Hw_Channel[hw_timer]          = channel;
+
+            Gpt_EnableClock(hw_timer);
+
+            REGISTER(base, GPT_CTL_REG_OFFSET) &= ~GPT_TAEN_MASK;       /* Disable timer A while configuring it */
+            if(hw_timer < GPT_HW_WTIMER0)
+            {
+                REGISTER(base, GPT_CFG_REG_OFFSET) = GPT_CONFIG_32_BIT;  /* 32-bit timer without prescaler */
+            }
+            else
+            {
+                REGISTER(base, GPT_CFG_REG_OFFSET)  = GPT_CONFIG_WIDE_32_BIT;  /* 32-bit timer behind a 16-bit prescaler */
+                REGISTER(base, GPT_TAPR_REG_OFFSET) = ConfigPtr->Channels[channel].Prescaler;
+            }
+            /* Counting down, periodic for the continuous mode */
+            REGISTER(base, GPT_TAMR_REG_OFFSET) = (GPT_CH_MODE_CONTINUOUS == ConfigPtr->Channels[channel].Mode) ?
+                                                  GPT_PERIODIC_MODE : GPT_ONE_SHOT_MODE;
+            REGISTER(base, GPT_ICR_REG_OFFSET)  = GPT_TATO_MASK;        /* Clear any old time-out flag */
+            REGISTER(base, GPT_IMR_REG_OFFSET) |= GPT_TATO_MASK;        /* Enable the time-out interrupt */
+
+            Gpt_EnableInterrupt(hw_timer, ConfigPtr->Channels[channel].Priority);
+        }
+
+        g_Gpt_Status = GPT_INITIALIZED;
+    }
+}
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop all the channels and disable their interrupts.
+************************************************************************************/
+void Gpt_DeInit(void)
+{
+    Gpt_ChannelType channel;
+    uint32 base;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if(GPT_NOT_INITIALIZED == g_Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_UNINIT);
+    }
+    else
+#endif
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            base = g_Gpt_Base_Address[g_Gpt_Channels[channel].HwTimer];
+
+            REGISTER(base, GPT_CTL_REG_OFFSET) &= ~GPT_TAEN_MASK;
+            REGISTER(base, GPT_IMR_REG_OFFSET) &= ~GPT_TATO_MASK;
+            REGISTER(base, GPT_ICR_REG_OFFSET)  = GPT_TATO_MASK;
+            Gpt_DisableInterrupt(g_Gpt_Channels[channel].HwTimer);
+
+            g_Gpt_Channel_State[channel]        = GPT_CHANNEL_STOPPED;
+            g_Gpt_Notification_Enabled[channel] = FALSE;
+        }
+
+        g_Gpt_Status = GPT_NOT_INITIALIZED;
+    }
+}
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Channel ticks elapsed since the start of the current period,
+*                               the target time once a one-shot channel expired, 0 before the first start
+* Description: Function to read how far a channel is in its current period.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType elapsed = 0;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID))
+#endif
+    {
+        switch(g_Gpt_Channel_State[Channel])
+        {
+            case GPT_CHANNEL_RUNNING:
+                elapsed = Gpt_ReadElapsed(Channel);
+                break;
+            case GPT_CHANNEL_EXPIRED:
+                elapsed = g_Gpt_Target[Channel];
+                break;
+            default:
+                elapsed = g_Gpt_Stop_Elapsed[Channel];
+                break;
+        }
+    }
+
+    return elapsed;
+}
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Channel ticks remaining until the target time,
+*                               0 once a one-shot channel expired or before the first start
+* Description: Function to read the time left in the current period of a channel.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType remaining = 0;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID))
+#endif
+    {
+        switch(g_Gpt_Channel_State[Channel])
+        {
+            case GPT_CHANNEL_RUNNING:
+                remaining = g_Gpt_Target[Channel] - Gpt_ReadElapsed(Channel);
+                break;
+            case GPT_CHANNEL_EXPIRED:
+                remaining = 0;
+                break;
+            default:
+                remaining = g_Gpt_Target[Channel] - g_Gpt_Stop_Elapsed[Channel];
+                break;
+        }
+    }
+
+    return remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+*                  Value - Target time in channel ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a channel with a target time in its configured mode.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+    uint32 base;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_START_TIMER_SID);
+    if(FALSE == error)
+    {
+        if(0U == Value)
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+            error = TRUE;
+        }
+        else if(GPT_CHANNEL_RUNNING == g_Gpt_Channel_State[Channel])
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+            error = TRUE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+#endif
+
+    if(FALSE == error)
+    {
+        base = g_Gpt_Base_Address[g_Gpt_Channels[Channel].HwTimer];
+
+        REGISTER(base, GPT_CTL_REG_OFFSET)  &= ~GPT_TAEN_MASK;
+        REGISTER(base, GPT_TAILR_REG_OFFSET) = Value - 1U;          /* Time-out after Value ticks */
+        REGISTER(base, GPT_ICR_REG_OFFSET)   = GPT_TATO_MASK;
+        g_Gpt_Target[Channel]        = Value;
+        g_Gpt_Channel_State[Channel] = GPT_CHANNEL_RUNNING;
+        REGISTER(base, GPT_CTL_REG_OFFSET)  |= GPT_TAEN_MASK;       /* The counter loads the target when enabled */
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a channel, a pending notification is dropped.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+    uint32 base;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID))
+#endif
+    {
+        /* Nothing to do for a channel that is not running */
+        if(GPT_CHANNEL_RUNNING == g_Gpt_Channel_State[Channel])
+        {
+            base = g_Gpt_Base_Address[g_Gpt_Channels[Channel].HwTimer];
+
+            REGISTER(base, GPT_CTL_REG_OFFSET) &= ~GPT_TAEN_MASK;
+            g_Gpt_Stop_Elapsed[Channel]  = Gpt_ReadElapsed(Channel);
+            g_Gpt_Channel_State[Channel] = GPT_CHANNEL_STOPPED;
+
+            REGISTER(base, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+            REGISTER(GPT_NVIC_UNPEND_BASE_ADDRESS, (g_Gpt_Irq[g_Gpt_Channels[Channel].HwTimer] / 32U) * 4U) =
+                (1UL << (g_Gpt_Irq[g_Gpt_Channels[Channel].HwTimer] % 32U));
+        }
+    }
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of a channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(TRUE == Gpt_CheckChannel(Channel, GPT_ENABLE_NOTIFICATION_SID))
+    {
+        /* Reported by Gpt_CheckChannel */
+    }
+    /* Check if the channel has a notification function */
+    else if(NULL_PTR == g_Gpt_Channels[Channel].Notification)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+    }
+    else
+#endif
+    {
+        g_Gpt_Notification_Enabled[Channel] = TRUE;
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of a channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(TRUE == Gpt_CheckChannel(Channel, GPT_DISABLE_NOTIFICATION_SID))
+    {
+        /* Reported by Gpt_CheckChannel */
+    }
+    /* Check if the channel has a notification function */
+    else if(NULL_PTR == g_Gpt_Channels[Channel].Notification)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+    }
+    else
+#endif
+    {
+        g_Gpt_Notification_Enabled[Channel] = FALSE;
+    }
+}
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+void Gpt_GetVersionInfo(Std_VersionInfoType * versioninfo)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)GPT_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)GPT_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+    }
 }
+#endif
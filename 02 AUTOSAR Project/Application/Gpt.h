@@ -4,7 +4,9 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver.
+ *              SysTick Timer (Os tick), Timer0A (Os timing protection) and the Gpt channels
+ *              on the 16/32-bit and 32/64-bit General-Purpose Timer blocks.
  *
  * Author: Zeyad Hisham
  ******************************************************************************/
@@ -12,8 +14,185 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt hardware timers ... the 16/32-bit blocks then the 32/64-bit wide blocks */
+#define GPT_HW_TIMER0                  (0U)
+#define GPT_HW_TIMER1                  (1U)
+#define GPT_HW_TIMER2                  (2U)
+#define GPT_HW_TIMER3                  (3U)
+#define GPT_HW_TIMER4                  (4U)
+#define GPT_HW_TIMER5                  (5U)
+#define GPT_HW_WTIMER0                 (6U)
+#define GPT_HW_WTIMER1                 (7U)
+#define GPT_HW_WTIMER2                 (8U)
+#define GPT_HW_WTIMER3                 (9U)
+#define GPT_HW_WTIMER4                 (10U)
+#define GPT_HW_WTIMER5                 (11U)
+#define GPT_HW_TIMERS_NUM              (12U)
+
+/* Mcu clock API ... the SysTick reload and the channel prescalers follow the system clock */
+#include "Mcu.h"
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+#if (SYSTICK_MAX_SUBSCRIBERS == 0U) || (SYSTICK_MAX_SUBSCRIBERS > 255U)
+  #error "SYSTICK_MAX_SUBSCRIBERS must be in the range 1 .. 255"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Maximum value of the SysTick Timer 24-bit reload register */
+#define SYSTICK_MAX_RELOAD_VALUE    0x00FFFFFF
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for GPT GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID       (uint8)0x00
+
+/* Service ID for GPT Init */
+#define GPT_INIT_SID                   (uint8)0x01
+
+/* Service ID for GPT DeInit */
+#define GPT_DEINIT_SID                 (uint8)0x02
+
+/* Service ID for GPT GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID       (uint8)0x03
+
+/* Service ID for GPT GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID     (uint8)0x04
+
+/* Service ID for GPT StartTimer */
+#define GPT_START_TIMER_SID            (uint8)0x05
+
+/* Service ID for GPT StopTimer */
+#define GPT_STOP_TIMER_SID             (uint8)0x06
+
+/* Service ID for GPT EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for GPT DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID   (uint8)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service used without module initialization */
+#define GPT_E_UNINIT                   (uint8)0x0A
+
+/* Gpt_StartTimer called for a running channel */
+#define GPT_E_BUSY                     (uint8)0x0B
+
+/* Gpt_Init called while the driver is already initialized */
+#define GPT_E_ALREADY_INITIALIZED      (uint8)0x0D
+
+/* Gpt_Init called with a configuration using Timer 0, a prescaler on a 16/32-bit timer or an invalid priority */
+#define GPT_E_PARAM_CONFIG             (uint8)0x0E
+
+/* DET code to report Invalid Channel (or a channel without notification function) */
+#define GPT_E_PARAM_CHANNEL            (uint8)0x14
+
+/* Gpt_StartTimer called with a 0 target time */
+#define GPT_E_PARAM_VALUE              (uint8)0x15
+
+/* API service called with NULL pointer parameter */
+#define GPT_E_PARAM_POINTER            (uint8)0x16
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the GPT APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType used by the GPT APIs ... channel ticks */
+typedef uint32 Gpt_ValueType;
+
+/* Type definition for Gpt_HwTimerType ... GPT_HW_TIMER1 .. GPT_HW_WTIMER5 */
+typedef uint8 Gpt_HwTimerType;
+
+/* Behavior of a channel once its target time is reached */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS,     /* Restart with the same target time and notify every period */
+    GPT_CH_MODE_ONESHOT         /* Stop and notify once */
+} Gpt_ChannelModeType;
+
+/* Type definition for a channel notification function, called from the timer interrupt */
+typedef void (*Gpt_NotificationType)(void);
+
+typedef struct
+{
+    /* Member contains the General-Purpose Timer block used by the channel */
+    Gpt_HwTimerType HwTimer;
+    /* Member contains the mode of the channel */
+    Gpt_ChannelModeType Mode;
+    /* Member contains the prescaler of the channel tick (wide timers only) */
+    uint16 Prescaler;
+    /* Member contains the priority of the channel interrupt */
+    uint8 Priority;
+    /* Member contains the notification function, NULL_PTR for none */
+    Gpt_NotificationType Notification;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+    Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -27,10 +206,11 @@
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the system clock given by Mcu_GetSysClockFrequency
+*              - Chain several equal timer periods when n miliseconds do not fit the 24-bit reload
+*              - Enable SysTick Timer with System clock
 *              - Enable SysTick Timer Interrupt and set its priority
-************************************************************************************/	
+************************************************************************************/
 void SysTick_Start(uint16 Tick_Time);
 
 /************************************************************************************
@@ -46,15 +226,277 @@ void SysTick_Start(uint16 Tick_Time);
 void SysTick_Stop(void);
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_AddSubscriber
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
 * Parameters (in): Ptr2Func - Call Back function address
+*                  Divisor - Number of SysTick periods between two calls (1 .. 65535)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is added
+*                                E_NOT_OK if it is NULL_PTR or already added, the Divisor is 0 or the table is full
+* Description: Function to add a function called from the SysTick ISR every Divisor periods,
+*              up to SYSTICK_MAX_SUBSCRIBERS functions. Safe against the ISR.
+************************************************************************************/
+Std_ReturnType SysTick_AddSubscriber(void (*Ptr2Func)(void), uint16 Divisor);
+
+/************************************************************************************
+* Service Name: SysTick_RemoveSubscriber
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Ptr2Func - Call Back function address added by SysTick_AddSubscriber
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is removed
+*                                E_NOT_OK if it is not a subscriber
+* Description: Function to stop calling a function from the SysTick ISR. Safe against the ISR.
+************************************************************************************/
+Std_ReturnType SysTick_RemoveSubscriber(void (*Ptr2Func)(void));
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeElapsed
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts elapsed since the last SysTick interrupt
+* Description: Function to read how far the SysTick Timer is in the current period.
+*              Elapsed + Remaining time is always equal to the reload value (period - 1),
+*              the elapsed time is not valid during a period changed by SysTick_AdjustTimeRemaining.
+************************************************************************************/
+uint32 SysTick_GetTimeElapsed(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeRemaining
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts remaining until the next SysTick interrupt
+* Description: Function to read the SysTick Timer current (down counting) value.
+************************************************************************************/
+uint32 SysTick_GetTimeRemaining(void);
+
+/************************************************************************************
+* Service Name: SysTick_IsInterruptPending
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the SysTick interrupt is pending and not served yet
+* Description: Function to check if the SysTick Timer expired while its interrupt is masked.
+************************************************************************************/
+boolean SysTick_IsInterruptPending(void);
+
+/************************************************************************************
+* Service Name: SysTick_AdjustTimeRemaining
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): Delta - Timer counts to add to (or remove from) the current period
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the current period is adjusted
+*                                E_NOT_OK if the timer already expired or the result does not fit 24 bits
+* Description: Function to lengthen or shorten the current SysTick period only, the periods
+*              after it use the reload value set by SysTick_Start again.
+*              The counts spent while the timer is stopped are compensated so no drift is added.
+*              Should be called with the interrupts masked.
+************************************************************************************/
+Std_ReturnType SysTick_AdjustTimeRemaining(sint32 Delta);
+
+/************************************************************************************
+* Service Name: Timer0A_Init
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup Timer0A as a 32-bit one-shot down counter on the system clock:
+*              - Enable the Timer0 clock
+*              - Enable the time-out interrupt with the highest priority (0) so BASEPRI cannot mask it
+*              The timer is started later by Timer0A_StartOneShot.
 ************************************************************************************/
-void SysTick_SetCallBack(void (*Ptr2Func)(void));
+void Timer0A_Init(void);
+
+/************************************************************************************
+* Service Name: Timer0A_StartOneShot
+* Sync/Async: Asynchronous
+* Reentrancy: non reentrant
+* Parameters (in): Counts - Timer counts (system clock cycles) until the time-out interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer0A once, its interrupt vector is owned by the upper layer
+*              which calls Timer0A_ClearInterrupt.
+************************************************************************************/
+void Timer0A_StartOneShot(uint32 Counts);
+
+/************************************************************************************
+* Service Name: Timer0A_Stop
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Timer counts that were remaining until the time-out
+* Description: Function to stop Timer0A and drop a pending time-out interrupt (0 remaining counts if it expired).
+************************************************************************************/
+uint32 Timer0A_Stop(void);
+
+/************************************************************************************
+* Service Name: Timer0A_ClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the Timer0A time-out interrupt flag.
+************************************************************************************/
+void Timer0A_ClearInterrupt(void);
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module:
+*              - Enable the clock of the timer block of every channel
+*              - Setup its mode, prescaler and time-out interrupt priority
+*              The channels are stopped and their notifications disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop all the channels and disable their interrupts.
+************************************************************************************/
+void Gpt_DeInit(void);
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Channel ticks elapsed since the start of the current period,
+*                               the target time once a one-shot channel expired, 0 before the first start
+* Description: Function to read how far a channel is in its current period.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Channel ticks remaining until the target time,
+*                               0 once a one-shot channel expired or before the first start
+* Description: Function to read the time left in the current period of a channel.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+*                  Value - Target time in channel ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a channel with a target time in its configured mode.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a channel, a pending notification is dropped.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of a channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of a channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+void Gpt_GetVersionInfo(Std_VersionInfoType * versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
 
 #endif /* GPT_H */
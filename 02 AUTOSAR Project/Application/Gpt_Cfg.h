@@ -0,0 +1,91 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                      (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/*
+ * Pre-compile option to call the Os tick function directly from SysTick_Handler (bound at link time) instead of
+ * as a SysTick subscriber, the subscribers are called after the Os tick
+ */
+#define SYSTICK_OS_TICK_DIRECT_CALL         (STD_ON)
+
+/* Function called on every SysTick interrupt when SYSTICK_OS_TICK_DIRECT_CALL is STD_ON */
+#define SYSTICK_OS_TICK_FUNCTION            Os_NewTimerTick
+
+/* Size of the SysTick subscriber table (SysTick_AddSubscriber), at most 255 */
+#define SYSTICK_MAX_SUBSCRIBERS             (4U)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (2U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_TIMEBASE_CHANNEL_ID_INDEX   (uint8)0x00
+#define GptConf_TIMEOUT_CHANNEL_ID_INDEX    (uint8)0x01
+
+/*
+ * Gpt Configured hardware timers ... Timer 0 is used by the Os timing protection (Timer0A_*) and
+ * cannot be configured as a channel
+ */
+#define GptConf_TIMEBASE_CHANNEL_HW_TIMER   (Gpt_HwTimerType)GPT_HW_TIMER1       /* 32-bit timer on the system clock */
+#define GptConf_TIMEOUT_CHANNEL_HW_TIMER    (Gpt_HwTimerType)GPT_HW_WTIMER0      /* 32-bit timer behind a 16-bit prescaler */
+
+/* Gpt Configured channel modes used by Gpt_StartTimer */
+#define GptConf_TIMEBASE_CHANNEL_MODE       GPT_CH_MODE_CONTINUOUS
+#define GptConf_TIMEOUT_CHANNEL_MODE        GPT_CH_MODE_ONESHOT
+
+/*
+ * Gpt Configured prescalers ... one channel tick is (prescaler + 1) system clock cycles,
+ * the 16/32-bit timers run in the 32-bit mode without prescaler (0 only)
+ */
+#define GptConf_TIMEBASE_CHANNEL_PRESCALER  (0U)
+#define GptConf_TIMEOUT_CHANNEL_PRESCALER   ((MCU_SYS_CLOCK_FREQUENCY / 1000000U) - 1U)  /* 1 us ticks at any clock */
+
+/*
+ * Gpt Configured interrupt priorities (0 .. 7, lower value is higher priority) ...
+ * below the SysTick priority (3) so a notification never delays the Os tick
+ */
+#define GptConf_TIMEBASE_CHANNEL_PRIORITY   (4U)
+#define GptConf_TIMEOUT_CHANNEL_PRIORITY    (4U)
+
+#endif /* GPT_CFG_H */
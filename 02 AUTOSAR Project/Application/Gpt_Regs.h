@@ -0,0 +1,48 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H_
+#define GPT_REGS_H_
+
+/* 16/32-bit General-Purpose Timer blocks base addresses */
+#define GPT_TIMER0_BASE_ADDRESS           0x40030000
+#define GPT_TIMER1_BASE_ADDRESS           0x40031000
+#define GPT_TIMER2_BASE_ADDRESS           0x40032000
+#define GPT_TIMER3_BASE_ADDRESS           0x40033000
+#define GPT_TIMER4_BASE_ADDRESS           0x40034000
+#define GPT_TIMER5_BASE_ADDRESS           0x40035000
+
+/* 32/64-bit Wide General-Purpose Timer blocks base addresses */
+#define GPT_WTIMER0_BASE_ADDRESS          0x40036000
+#define GPT_WTIMER1_BASE_ADDRESS          0x40037000
+#define GPT_WTIMER2_BASE_ADDRESS          0x4004C000
+#define GPT_WTIMER3_BASE_ADDRESS          0x4004D000
+#define GPT_WTIMER4_BASE_ADDRESS          0x4004E000
+#define GPT_WTIMER5_BASE_ADDRESS          0x4004F000
+
+/* Timer Registers offset addresses */
+#define GPT_CFG_REG_OFFSET                0x000
+#define GPT_TAMR_REG_OFFSET               0x004
+#define GPT_CTL_REG_OFFSET                0x00C
+#define GPT_IMR_REG_OFFSET                0x018
+#define GPT_RIS_REG_OFFSET                0x01C
+#define GPT_ICR_REG_OFFSET                0x024
+#define GPT_TAILR_REG_OFFSET              0x028
+#define GPT_TAPR_REG_OFFSET               0x038
+#define GPT_TAV_REG_OFFSET                0x050
+
+/* NVIC priority (one byte per interrupt), set-enable, clear-enable and clear-pending registers base addresses */
+#define GPT_NVIC_PRI_BASE_ADDRESS         0xE000E400
+#define GPT_NVIC_EN_BASE_ADDRESS          0xE000E100
+#define GPT_NVIC_DIS_BASE_ADDRESS         0xE000E180
+#define GPT_NVIC_UNPEND_BASE_ADDRESS      0xE000E280
+
+#endif /* GPT_REGS_H_ */
@@ -9,11 +9,80 @@
  * Author: Zeyad Hisham
  ******************************************************************************/
 
+#include "Mcu.h"
 #include "tm4c123gh6pm_registers.h"
 
+/* Run-Mode Clock Configuration (RCC / RCC2) fields */
+#define MCU_RCC_MOSCDIS_MASK        0x00000001
+#define MCU_RCC_XTAL_MASK           0x000007C0
+#define MCU_RCC_XTAL_16MHZ          0x00000540
+#define MCU_RCC2_USERCC2_MASK       0x80000000
+#define MCU_RCC2_DIV400_MASK        0x40000000
+#define MCU_RCC2_SYSDIV_MASK        0x1FC00000
+#define MCU_RCC2_SYSDIV_POS         22
+#define MCU_RCC2_PWRDN2_MASK        0x00002000
+#define MCU_RCC2_BYPASS2_MASK       0x00000800
+#define MCU_RCC2_OSCSRC2_MASK       0x00000070
+#define MCU_RIS_PLLLRIS_MASK        0x00000040
+
+/* The system clock runs from the PIOSC until Mcu_InitClock switches it */
+static uint32 g_Mcu_Clock_Frequency = MCU_PIOSC_FREQUENCY;
+
 void Mcu_Init(void)
 {
     /* Enable clock for All PORTs and wait for clock to start */
     SYSCTL_RCGCGPIO_REG |= 0x3F;
     while(!(SYSCTL_PRGPIO_REG & 0x3F));
 }
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the configured source (Mcu_Cfg.h):
+*              - Run from the main oscillator while the PLL powers up
+*              - Select the 400 MHz PLL output and its divisor
+*              - Wait for the PLL lock then clear the bypass
+************************************************************************************/
+void Mcu_InitClock(void)
+{
+#if (MCU_PLL_ENABLE == STD_ON)
+    /* Use RCC2 fields, bypass the PLL while it is configured */
+    SYSCTL_RCC2_REG |= MCU_RCC2_USERCC2_MASK;
+    SYSCTL_RCC2_REG |= MCU_RCC2_BYPASS2_MASK;
+
+    /* 16 MHz crystal on the main oscillator selected as the PLL input */
+    SYSCTL_RCC_REG   = (SYSCTL_RCC_REG & ~(MCU_RCC_XTAL_MASK | MCU_RCC_MOSCDIS_MASK)) | MCU_RCC_XTAL_16MHZ;
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_OSCSRC2_MASK;
+
+    /* Power the PLL up then divide its 400 MHz output by MCU_PLL_DIVISOR */
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_PWRDN2_MASK;
+    SYSCTL_RCC2_REG |= MCU_RCC2_DIV400_MASK;
+    SYSCTL_RCC2_REG  = (SYSCTL_RCC2_REG & ~MCU_RCC2_SYSDIV_MASK) | ((uint32)(MCU_PLL_DIVISOR - 1U) << MCU_RCC2_SYSDIV_POS);
+
+    /* Wait for the PLL to lock then run the system clock from it */
+    while(!(SYSCTL_RIS_REG & MCU_RIS_PLLLRIS_MASK));
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_BYPASS2_MASK;
+#endif
+
+    g_Mcu_Clock_Frequency = MCU_SYS_CLOCK_FREQUENCY;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetSysClockFrequency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current system clock frequency in Hz
+* Description: Function to get the frequency the SysTick and General-Purpose Timers count at.
+************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void)
+{
+    return g_Mcu_Clock_Frequency;
+}
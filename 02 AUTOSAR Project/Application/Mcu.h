@@ -15,6 +15,48 @@
 
 #include "Std_Types.h"
 
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+#if (MCU_PLL_ENABLE == STD_ON) && ((MCU_PLL_DIVISOR < 5U) || (MCU_PLL_DIVISOR > 128U))
+  #error "MCU_PLL_DIVISOR must be in the range 5 .. 128 (80 MHz .. 3.125 MHz)"
+#endif
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the clock of all the GPIO Ports.
+************************************************************************************/
 void Mcu_Init(void);
 
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the configured source (Mcu_Cfg.h),
+*              must be called before any timer is started from the system clock.
+************************************************************************************/
+void Mcu_InitClock(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetSysClockFrequency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current system clock frequency in Hz
+* Description: Function to get the frequency the SysTick and General-Purpose Timers count at.
+************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void);
+
 #endif /* MCU_H_ */
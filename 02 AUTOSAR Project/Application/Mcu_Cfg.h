@@ -0,0 +1,37 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H_
+#define MCU_CFG_H_
+
+/* Frequency of the precision internal oscillator used as system clock after reset */
+#define MCU_PIOSC_FREQUENCY                 (16000000U)
+
+/* Frequency of the PLL output with the 400 MHz output selected (DIV400) */
+#define MCU_PLL_FREQUENCY                   (400000000U)
+
+/*
+ * Pre-compile option to run the system clock from the PLL locked on the 16 MHz main oscillator crystal,
+ * STD_OFF keeps the PIOSC clock of the reset
+ */
+#define MCU_PLL_ENABLE                      (STD_OFF)
+
+/* PLL output divisor (5 .. 128) ... 5 gives the maximum system clock of 80 MHz */
+#define MCU_PLL_DIVISOR                     (5U)
+
+/* System clock set by Mcu_InitClock, the timebases compute their reload values from it */
+#if (MCU_PLL_ENABLE == STD_ON)
+#define MCU_SYS_CLOCK_FREQUENCY             (MCU_PLL_FREQUENCY / MCU_PLL_DIVISOR)
+#else
+#define MCU_SYS_CLOCK_FREQUENCY             MCU_PIOSC_FREQUENCY
+#endif
+
+#endif /* MCU_CFG_H_ */
@@ -14,93 +14,2117 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "tm4c123gh6pm_registers.h"
+#if (OS_TIMING_PROTECTION == STD_ON)
+#include "Det.h"
+#include <setjmp.h>
+#endif
 
+/* The Os reads one SysTick period as its tick (tickless idle, time stamps), it must not be a chained period */
+#if (((MCU_SYS_CLOCK_FREQUENCY / 1000U) * OS_BASE_TIME) > (SYSTICK_MAX_RELOAD_VALUE + 1U))
+  #error "OS_BASE_TIME must fit one SysTick period at MCU_SYS_CLOCK_FREQUENCY"
+#endif
+
+#ifdef OS_HOST_BUILD
+/* The host build simulates the PRIMASK and the sleep of the core */
+#define Enable_Exceptions()    Os_HostEnableInterrupts()
+#define Disable_Exceptions()   Os_HostDisableInterrupts()
+#else
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
-/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
-#define Disable_Exceptions()   __asm(" CPSID I ")
+/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
+#define Disable_Exceptions()   __asm(" CPSID I ")
+#endif
+
+/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
+#define Enable_Faults()        __asm(" CPSIE F ")
+
+/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
+#define Disable_Faults()       __asm(" CPSID F ")
+
+#if (OS_IDLE_SLEEP == STD_ON)
+#ifdef OS_HOST_BUILD
+#define Wait_For_Interrupt()   Os_HostWaitForInterrupt()
+#else
+/* Wait For Interrupt ... This Macro puts the core in sleep mode until an interrupt becomes pending even if it is masked by the PRIMASK */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+#endif
+
+/* Idle time accumulated during the current hyperperiod in timer counts */
+static uint32 g_Idle_Time_Accumulator = 0;
+
+/* Idle and busy time of the last complete hyperperiod in timer counts */
+static uint32 g_Idle_Time = 0;
+static uint32 g_Busy_Time = 0;
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+/* Full load in the 0.01 % unit */
+#define OS_CPU_LOAD_FULL            (10000U)
+
+static volatile Os_CpuLoadType g_Cpu_Load = {0, 0, 0, 0};
+
+/* Moving average of the load scaled by 2^OS_CPU_LOAD_AVERAGE_SHIFT, 0 until the first hyperperiod completes */
+static uint32 g_Cpu_Load_Average_Scaled = 0;
+#endif
+
+/* Count Leading Zeros ... one CLZ instruction, 32 for a zero value */
+#ifdef OS_HOST_BUILD
+#define Os_CountLeadingZeros(Value) (((Value) == 0) ? 32U : (uint32)__builtin_clz(Value))
+#else
+#define Os_CountLeadingZeros(Value) ((uint32)_norm(Value))
+#endif
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+#define DWT_TRCENA_MASK             0x01000000
+#define DWT_CYCCNTENA_MASK          0x00000001
+
+#ifdef OS_HOST_BUILD
+/* The host build provides a simulated cycle counter */
+#define Os_ReadCycleCounter()       Os_HostCycleCounter()
+#else
+/* Read the DWT cycle counter ... counts the CPU cycles and wraps after 2^32 cycles */
+#define Os_ReadCycleCounter()       (DWT_CYCCNT_REG)
+#endif
+
+/* Accumulated execution and response times of a task */
+typedef struct
+{
+    uint32 MinExecutionTime;
+    uint32 MaxExecutionTime;
+    uint64 SumExecutionTime;
+    uint32 MinResponseTime;
+    uint32 MaxResponseTime;
+    uint64 SumResponseTime;
+    uint32 Activations;
+} Os_TaskTimeRecordType;
+
+static Os_TaskTimeRecordType g_Task_Time[OS_CONFIGURED_TASKS];
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Cycle counter when the task was released (the cooperative Os uses g_Tick_Release_Stamp) */
+static uint32 g_Task_Release_Stamp[OS_CONFIGURED_TASKS];
+#endif
+
+/* Cycle counter when the task was last activated by Os_SetEvent */
+static uint32 g_Task_Event_Stamp[OS_CONFIGURED_TASKS];
+
+/* Cycle counter at the last tick interrupt and the timer period in cycles */
+static volatile uint32 g_Tick_Stamp = 0;
+static uint32 g_Tick_Cycles = 0;
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/* Release time of the tick whose releases are running */
+static uint32 g_Tick_Release_Stamp = 0;
+#endif
+
+static uint32 g_Init_Task_Time = 0;
+#endif
+
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+static uint32 g_Tick_Jitter_Histogram[OS_HISTOGRAM_BUCKETS];
+static uint32 g_Dispatch_Latency_Histogram[OS_CONFIGURED_TASKS][OS_HISTOGRAM_BUCKETS];
+
+/* Tick count and cycle counter at the previous tick interrupt */
+static uint32 g_Jitter_Last_Tick = 0;
+static uint32 g_Jitter_Last_Stamp = 0;
+#endif
+
+#if (OS_RESOURCES == STD_ON)
+/* BASEPRI holds the priority in its upper 3 bits */
+#define OS_BASEPRI_BITS_POS         (5U)
+#define OS_RESOURCE_NONE            (0xFFU)
+
+/* BASEPRI before every locked resource and the resource locked before it */
+static uint32 g_Resource_Saved_Basepri[OS_CONFIGURED_RESOURCES];
+static uint8 g_Resource_Previous[OS_CONFIGURED_RESOURCES];
+static boolean g_Resource_Locked[OS_CONFIGURED_RESOURCES];
+
+/* Last locked resource */
+static uint8 g_Resource_Last = OS_RESOURCE_NONE;
+
+#ifdef OS_HOST_BUILD
+static uint32 g_Host_Basepri = 0;
+
+static uint32 Os_RaiseBasepri(uint32 Basepri)
+{
+    uint32 previous = g_Host_Basepri;
+
+    if((g_Host_Basepri == 0) || ((Basepri != 0) && (Basepri < g_Host_Basepri)))
+    {
+        g_Host_Basepri = Basepri;
+    }
+    return previous;
+}
+
+static void Os_SetBasepri(uint32 Basepri)
+{
+    g_Host_Basepri = Basepri;
+}
+#else
+/* Raise BASEPRI (BASEPRI_MAX never lowers it) and return its previous value */
+uint32 Os_RaiseBasepri(uint32 Basepri);
+
+/* Restore a BASEPRI value */
+void Os_SetBasepri(uint32 Basepri);
+
+__asm("        .thumb                          \n"
+      "        .global Os_RaiseBasepri         \n"
+      "        .global Os_SetBasepri           \n"
+      "Os_RaiseBasepri:                        \n"
+      "        MRS      R1, BASEPRI            \n"
+      "        MSR      BASEPRI_MAX, R0        \n"
+      "        MOV      R0, R1                 \n"
+      "        BX       LR                     \n"
+      "Os_SetBasepri:                          \n"
+      "        MSR      BASEPRI, R0            \n"
+      "        BX       LR                     \n");
+#endif
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/* Marker of no task running under a budget */
+#define OS_NO_TASK                  (0xFFU)
+
+/* Timer counts before the next try when the budget expires while an interrupt preempts the task */
+#define OS_PROTECTION_RETRY_COUNTS  (100U)
+
+/* Exception frame stacked by the HW for the interrupted context */
+#define OS_EXC_FRAME_R0             (0U)
+#define OS_EXC_FRAME_PC             (6U)
+#define OS_EXC_FRAME_XPSR           (7U)
+#define OS_EXC_RETURN_THREAD_MASK   (0x00000008U)    /* EXC_RETURN bit set for a return to the thread mode */
+#define OS_XPSR_ALIGN_MASK          (0x00000200U)    /* The HW padded the stack to 8 bytes when stacking the frame */
+#define OS_XPSR_THUMB               (0x01000000U)
+
+/* Budgets in timer counts (system clock cycles) */
+static uint32 g_Budget_Counts[OS_CONFIGURED_TASKS];
+
+/* Budget violations of every task and the next release to skip after an ignored violation */
+static uint16 g_Budget_Violations[OS_CONFIGURED_TASKS];
+static volatile boolean g_Budget_Skip[OS_CONFIGURED_TASKS];
+
+/* Task whose budget is counted by Timer0A now */
+static volatile Os_TaskType g_Budget_Task = OS_NO_TASK;
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Budget left to every task when it is preempted */
+static uint32 g_Budget_Remaining[OS_CONFIGURED_TASKS];
+#elif !defined(OS_HOST_BUILD)
+/* Context saved before running a task, restored when the task is stopped */
+static jmp_buf g_Task_Kill_Context;
+#endif
+
+/* Called by Os_TimingProtectionHandler with the exception frame and the EXC_RETURN of the interrupted context */
+void Os_TimingProtection(uint32 * Frame, uint32 ExcReturn);
+
+#ifndef OS_HOST_BUILD
+/*
+ * Timer0A Handler:
+ * Pass the frame stacked for the interrupted context (MSP or PSP) so the task can be stopped by changing its return address
+ */
+__asm("        .thumb                          \n"
+      "        .global Os_TimingProtectionHandler \n"
+      "Os_TimingProtectionHandler:             \n"
+      "        TST      LR, #4                 \n"
+      "        ITE      EQ                     \n"
+      "        MRSEQ    R0, MSP                \n"
+      "        MRSNE    R0, PSP                \n"
+      "        MOV      R1, LR                 \n"
+      "        B        Os_TimingProtection    \n");
+#endif
+#endif
+
+/* Number of pending ticks processed in one scheduler round */
+#if (OS_MISSED_TICK_POLICY == OS_TICK_SKIP)
+#define OS_TICKS_TO_PROCESS    (1U)
+#else
+#define OS_TICKS_TO_PROCESS    (OS_MAX_CATCH_UP_TICKS)
+#endif
+
+/* Global variable store the Os Time ... number of ticks inside the current hyperperiod (owned by the scheduler) */
+static uint8 g_Time_Tick_Count = 0;
+
+/*
+ * Ticks counted by the timer interrupt and ticks processed by the scheduler, each one has a single writer
+ * so their difference is the number of pending ticks without masking the interrupts.
+ * g_Timer_Ticks is also the monotonic Os time base (wraps after 2^32 ticks).
+ */
+static volatile uint32 g_Timer_Ticks = 0;
+static volatile uint32 g_Processed_Ticks = 0;
+
+/* Scale converting timer counts to microseconds in 16.16 fixed point, computed once the timer is started */
+static uint32 g_Counts_To_Us_Scale = 0;
+
+/* Missed tick and overrun statistics */
+static volatile uint32 g_Missed_Ticks = 0;
+static uint32 g_Skipped_Ticks = 0;
+static uint16 g_Task_Overrun_Count[OS_CONFIGURED_TASKS];
+
+/*
+ * Precomputed dispatch schedules built once from the task table, one per application mode sharing g_Schedule_Tasks:
+ * the tasks released in tick n of mode m are g_Schedule_Tasks[g_Schedule_Start[m][n]] .. g_Schedule_Tasks[g_Schedule_Start[m][n+1] - 1]
+ */
+#if (OS_SCHEDULE_ENTRIES > 255U)
+typedef uint16 Os_ScheduleIndexType;
+#else
+typedef uint8 Os_ScheduleIndexType;
+#endif
+static Os_ScheduleIndexType g_Schedule_Start[OS_CONFIGURED_APP_MODES][OS_HYPERPERIOD_TICKS + 1];
+static Os_TaskType g_Schedule_Tasks[OS_SCHEDULE_ENTRIES];
+
+/* Application mode whose schedule is running */
+static Os_AppModeType g_App_Mode = OS_DEFAULT_APP_MODE;
+
+/* Disabled tasks get no releases */
+static boolean g_Task_Disabled[OS_CONFIGURED_TASKS];
+
+/* Mode and task changes requested by the application, applied at the next tick boundary */
+static volatile Os_AppModeType g_App_Mode_Request = OS_DEFAULT_APP_MODE;
+static volatile boolean g_Task_Disable_Request[OS_CONFIGURED_TASKS];
+static volatile boolean g_Requests_Pending = FALSE;
+
+/*
+ * Event activations: the activating context sets the task flag then g_Event_Set, the scheduler clears
+ * g_Event_Set then the task flag before running the task so an activation is never lost without masking
+ */
+static volatile boolean g_Event_Pending[OS_CONFIGURED_TASKS];
+static volatile boolean g_Event_Set = FALSE;
+
+#if (OS_ALARM_SERVICE == STD_ON)
+/*
+ * Hierarchical timer wheel: level n has 64 slots of 64^n ticks, an alarm is linked in the slot of its expiry at the lowest
+ * level covering the remaining time and cascades one level down when the wheel reaches its slot. Alarms further than
+ * the wheel range wait in the last level and are inserted again on every cascade until they are in range.
+ */
+#define OS_ALARM_WHEEL_BITS         (6U)
+#define OS_ALARM_WHEEL_SLOTS        (1U << OS_ALARM_WHEEL_BITS)
+#define OS_ALARM_WHEEL_MASK         (OS_ALARM_WHEEL_SLOTS - 1U)
+#define OS_ALARM_WHEEL_LEVELS       (3U)
+#define OS_ALARM_WHEEL_RANGE        (1UL << (OS_ALARM_WHEEL_BITS * OS_ALARM_WHEEL_LEVELS))
+#define OS_ALARM_NONE               (0xFFFFU)
+
+/* Alarm control block ... linked in a wheel slot while running */
+typedef struct
+{
+    uint32 Expiry;
+    uint32 Cycle;
+    Os_AlarmCallbackType Callback;
+    uint16 Slot;
+    uint16 Next;
+    uint16 Prev;
+} Os_AlarmControlType;
+
+static Os_AlarmControlType g_Alarms[OS_ALARMS_NUM];
+
+/* First alarm linked in every wheel slot */
+static uint16 g_Alarm_Wheel[OS_ALARM_WHEEL_LEVELS * OS_ALARM_WHEEL_SLOTS];
+
+/* Os tick reached by the alarm wheel */
+static uint32 g_Alarm_Time = 0;
+#endif
+
+#if (OS_DEFERRED_WORK == STD_ON)
+/* One deferred work item */
+typedef struct
+{
+    Os_DeferredWorkFuncType Func;
+    void * Context;
+} Os_DeferredWorkItemType;
+
+/*
+ * Deferred work ring buffer: the producers (tasks and interrupts) advance Head with the interrupts masked,
+ * the scheduler is the only consumer and advances Tail after copying the item
+ */
+static Os_DeferredWorkItemType g_Deferred_Work[OS_DEFERRED_WORK_QUEUE_LENGTH];
+static volatile uint16 g_Deferred_Work_Head = 0;
+static volatile uint16 g_Deferred_Work_Tail = 0;
+static uint32 g_Deferred_Work_Drops = 0;
+
+/* Tick whose budget is being used and time in us already used in it */
+static uint32 g_Deferred_Work_Tick = 0;
+static uint32 g_Deferred_Work_Spent = 0;
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/* Number of ticks from tick n of mode m to the next tick that has releases or starts a new hyperperiod */
+static uint8 g_Schedule_Next[OS_CONFIGURED_APP_MODES][OS_HYPERPERIOD_TICKS];
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+#define PENDSV_PRIORITY_MASK        0xFF1FFFFF
+#define PENDSV_INTERRUPT_PRIORITY   7
+#define PENDSV_PRIORITY_BITS_POS    21
+#define PENDSV_SET_MASK             0x10000000
+
+/* Context index of the idle context (the Os_Scheduler loop) and marker used before the first switch */
+#define OS_IDLE_CONTEXT             (OS_CONFIGURED_TASKS)
+#define OS_NO_CONTEXT               (0xFFU)
+
+/* Initial frame of a context: R4-R11 and EXC_RETURN saved by PendSV_Handler then R0-R3, R12, LR, PC, xPSR saved by the HW */
+#define OS_CONTEXT_FRAME_WORDS      (17U)
+#define OS_FRAME_EXC_RETURN         (8U)
+#define OS_FRAME_R0                 (9U)
+#define OS_FRAME_LR                 (14U)
+#define OS_FRAME_PC                 (15U)
+#define OS_FRAME_XPSR               (16U)
+#define OS_INITIAL_EXC_RETURN       (0xFFFFFFFDU)    /* Return to the thread mode using the PSP without FPU state */
+#define OS_INITIAL_XPSR             (0x01000000U)    /* Thumb state */
+
+/* Stacks of the tasks and of the idle context */
+#pragma DATA_ALIGN(g_Task_Stacks, 8)
+static uint32 g_Task_Stacks[OS_CONFIGURED_TASKS][OS_TASK_STACK_SIZE / 4U];
+#pragma DATA_ALIGN(g_Idle_Stack, 8)
+static uint32 g_Idle_Stack[OS_IDLE_STACK_SIZE / 4U];
+
+/* Saved stack pointer of every context and if the context has a valid frame on its stack */
+static uint32 * g_Context_Sp[OS_CONFIGURED_TASKS + 1];
+static boolean g_Context_Started[OS_CONFIGURED_TASKS + 1];
+
+/* Bit n is set while the task of priority n is ready, running or preempted */
+static uint32 g_Ready_Mask = 0;
+
+/* Task having each priority */
+static Os_TaskType g_Priority_Task[OS_CONFIGURED_TASKS];
+
+#if (OS_RESOURCES == STD_ON)
+/* Bit n is set while a task holds a resource of task ceiling n, the holder competes in Os_Dispatch with that priority */
+static volatile uint32 g_Ceiling_Mask = 0;
+
+/* Task holding every task ceiling and the ceiling mask before every locked resource */
+static Os_TaskType g_Ceiling_Task[OS_CONFIGURED_TASKS];
+static uint32 g_Resource_Saved_Ceiling_Mask[OS_CONFIGURED_RESOURCES];
+#endif
+
+/* Context running now and context selected to run after the pending PendSV */
+static uint8 g_Running_Context = OS_NO_CONTEXT;
+static uint8 g_Next_Context = OS_IDLE_CONTEXT;
+
+/* No context switch before Os_start completes the Init Task */
+static boolean g_Preemption_Started = FALSE;
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/* Cycles run by every task since its start excluding the preemptions, and cycle counter at the last switch */
+static uint32 g_Task_Run_Cycles[OS_CONFIGURED_TASKS];
+static uint32 g_Switch_Stamp = 0;
+#endif
+
+/* Called by PendSV_Handler with the saved stack pointer of the running context */
+uint32 * Os_SwitchContext(uint32 * Sp);
+
+/* Set the PSP used by the first context switch */
+void Os_SetProcessStack(uint32 * Sp);
+
+/* Complete the run of a task and switch away from its context */
+static void Os_TaskTerminate(Os_TaskType Task);
+
+/*
+ * PendSV Handler:
+ * Save R4-R11, EXC_RETURN (and S16-S31 if the context used the FPU) on the stack of the running context,
+ * get the stack of the next context from Os_SwitchContext and restore the same registers from it
+ */
+__asm("        .thumb                          \n"
+      "        .global PendSV_Handler          \n"
+      "        .global Os_SetProcessStack      \n"
+      "PendSV_Handler:                         \n"
+      "        CPSID    I                      \n"
+      "        MRS      R0, PSP                \n"
+      "        TST      LR, #0x10              \n"
+      "        IT       EQ                     \n"
+      "        VSTMDBEQ R0!, {S16-S31}         \n"
+      "        STMDB    R0!, {R4-R11, LR}      \n"
+      "        BL       Os_SwitchContext       \n"
+      "        LDMIA    R0!, {R4-R11, LR}      \n"
+      "        TST      LR, #0x10              \n"
+      "        IT       EQ                     \n"
+      "        VLDMIAEQ R0!, {S16-S31}         \n"
+      "        MSR      PSP, R0                \n"
+      "        CPSIE    I                      \n"
+      "        BX       LR                     \n"
+      "Os_SetProcessStack:                     \n"
+      "        MSR      PSP, R0                \n"
+      "        BX       LR                     \n");
+#endif
+
+/*********************************************************************************************/
+/* Description: Fill the dispatch schedule of every application mode with the tasks released in every tick of the hyperperiod */
+static void Os_BuildSchedule(void)
+{
+    uint8 tick;
+    Os_TaskType task;
+    Os_AppModeType mode;
+    uint16 period;
+    Os_ScheduleIndexType entry = 0;
+
+    for(mode = 0; mode < OS_CONFIGURED_APP_MODES; mode++)
+    {
+        for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+        {
+            g_Schedule_Start[mode][tick] = entry;
+            for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+            {
+                /* The task is released when the tick time matches its offset inside its period (event tasks have no releases) */
+                period = Os_Configuration.AppModes[mode].Periods[task];
+                if((period != 0) && ((((uint16)tick * OS_BASE_TIME) % period) == Os_Configuration.Tasks[task].Offset))
+                {
+                    g_Schedule_Tasks[entry] = task;
+                    entry++;
+                }
+            }
+        }
+        g_Schedule_Start[mode][OS_HYPERPERIOD_TICKS] = entry;
+    }
+
+#if (OS_PREEMPTIVE == STD_ON)
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        g_Priority_Task[Os_Configuration.Tasks[task].Priority] = task;
+    }
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+    for(mode = 0; mode < OS_CONFIGURED_APP_MODES; mode++)
+    {
+        /* Walk backwards so the distance of the following tick is already known */
+        for(tick = OS_HYPERPERIOD_TICKS; tick > 0; tick--)
+        {
+            uint8 following = tick % OS_HYPERPERIOD_TICKS;
+
+            if((following == 0) || (g_Schedule_Start[mode][following] != g_Schedule_Start[mode][following + 1]))
+            {
+                g_Schedule_Next[mode][tick - 1] = 1;
+            }
+            else
+            {
+                g_Schedule_Next[mode][tick - 1] = g_Schedule_Next[mode][following] + 1;
+            }
+        }
+    }
+#endif
+}
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Account the ticks whose interrupts were suppressed by the tickless idle */
+static void Os_StepTick(uint8 Ticks)
+{
+    g_Time_Tick_Count = (g_Time_Tick_Count + Ticks) % OS_HYPERPERIOD_TICKS;
+
+    /* Called with the interrupts masked so the timer interrupt cannot update the counters meanwhile */
+    g_Timer_Ticks     += Ticks;
+    g_Processed_Ticks += Ticks;
+
+#if (OS_ALARM_SERVICE == STD_ON)
+    /* The suppressed ticks have no alarm expiry nor wheel cascade */
+    g_Alarm_Time      += Ticks;
+#endif
+}
+#endif
+
+#if (OS_ALARM_SERVICE == STD_ON)
+/*********************************************************************************************/
+/* Description: Link an alarm in the wheel slot of its expiry, called with the interrupts masked */
+static void Os_AlarmInsert(Os_AlarmType AlarmId)
+{
+    uint32 expiry = g_Alarms[AlarmId].Expiry;
+    uint32 delta  = expiry - g_Alarm_Time;
+    uint16 slot;
+
+    if(delta < OS_ALARM_WHEEL_SLOTS)
+    {
+        slot = (uint16)(expiry & OS_ALARM_WHEEL_MASK);
+    }
+    else if(delta < (1UL << (2U * OS_ALARM_WHEEL_BITS)))
+    {
+        slot = (uint16)(OS_ALARM_WHEEL_SLOTS + ((expiry >> OS_ALARM_WHEEL_BITS) & OS_ALARM_WHEEL_MASK));
+    }
+    else
+    {
+        /* Out of the wheel range ... park it in the furthest slot, it is inserted again when that slot cascades */
+        if(delta >= OS_ALARM_WHEEL_RANGE)
+        {
+            expiry = g_Alarm_Time + OS_ALARM_WHEEL_RANGE - 1U;
+        }
+        slot = (uint16)((2U * OS_ALARM_WHEEL_SLOTS) + ((expiry >> (2U * OS_ALARM_WHEEL_BITS)) & OS_ALARM_WHEEL_MASK));
+    }
+
+    g_Alarms[AlarmId].Slot = slot;
+    g_Alarms[AlarmId].Prev = OS_ALARM_NONE;
+    g_Alarms[AlarmId].Next = g_Alarm_Wheel[slot];
+    if(g_Alarm_Wheel[slot] != OS_ALARM_NONE)
+    {
+        g_Alarms[g_Alarm_Wheel[slot]].Prev = AlarmId;
+    }
+    g_Alarm_Wheel[slot] = AlarmId;
+}
+
+/*********************************************************************************************/
+/* Description: Unlink an alarm from its wheel slot, called with the interrupts masked */
+static void Os_AlarmRemove(Os_AlarmType AlarmId)
+{
+    uint16 next = g_Alarms[AlarmId].Next;
+    uint16 prev = g_Alarms[AlarmId].Prev;
+
+    if(prev == OS_ALARM_NONE)
+    {
+        g_Alarm_Wheel[g_Alarms[AlarmId].Slot] = next;
+    }
+    else
+    {
+        g_Alarms[prev].Next = next;
+    }
+
+    if(next != OS_ALARM_NONE)
+    {
+        g_Alarms[next].Prev = prev;
+    }
+
+    g_Alarms[AlarmId].Slot = OS_ALARM_NONE;
+}
+
+/*********************************************************************************************/
+/* Description: Move the alarms of a higher level slot to the lower levels, called with the interrupts masked */
+static void Os_AlarmCascade(uint16 Slot)
+{
+    Os_AlarmType alarm;
+
+    while(g_Alarm_Wheel[Slot] != OS_ALARM_NONE)
+    {
+        alarm = g_Alarm_Wheel[Slot];
+        Os_AlarmRemove(alarm);
+        Os_AlarmInsert(alarm);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Reset the wheel before any alarm is started */
+static void Os_AlarmInit(void)
+{
+    uint16 index;
+
+    for(index = 0; index < (OS_ALARM_WHEEL_LEVELS * OS_ALARM_WHEEL_SLOTS); index++)
+    {
+        g_Alarm_Wheel[index] = OS_ALARM_NONE;
+    }
+
+    for(index = 0; index < OS_ALARMS_NUM; index++)
+    {
+        g_Alarms[index].Slot = OS_ALARM_NONE;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Move the alarm wheel to the next tick and call the callbacks of the expired alarms */
+static void Os_AlarmTick(void)
+{
+    uint32 now;
+    uint16 slot;
+    Os_AlarmType alarm;
+    Os_AlarmCallbackType callback;
+
+    Disable_Exceptions();
+    g_Alarm_Time++;
+    now = g_Alarm_Time;
+
+    /* Cascade the higher levels when the lower level wraps */
+    if((now & OS_ALARM_WHEEL_MASK) == 0)
+    {
+        if(((now >> OS_ALARM_WHEEL_BITS) & OS_ALARM_WHEEL_MASK) == 0)
+        {
+            Os_AlarmCascade((uint16)((2U * OS_ALARM_WHEEL_SLOTS) + ((now >> (2U * OS_ALARM_WHEEL_BITS)) & OS_ALARM_WHEEL_MASK)));
+        }
+        Os_AlarmCascade((uint16)(OS_ALARM_WHEEL_SLOTS + ((now >> OS_ALARM_WHEEL_BITS) & OS_ALARM_WHEEL_MASK)));
+    }
+
+    /* Every alarm left in this slot expires now ... no new alarm can be linked in it during the callbacks */
+    slot = (uint16)(now & OS_ALARM_WHEEL_MASK);
+    while(g_Alarm_Wheel[slot] != OS_ALARM_NONE)
+    {
+        alarm = g_Alarm_Wheel[slot];
+        Os_AlarmRemove(alarm);
+        callback = g_Alarms[alarm].Callback;
+
+        if(g_Alarms[alarm].Cycle != 0)
+        {
+            g_Alarms[alarm].Expiry += g_Alarms[alarm].Cycle;
+            Os_AlarmInsert(alarm);
+        }
+
+        /* The callback runs with the interrupts enabled */
+        Enable_Exceptions();
+        callback();
+        Disable_Exceptions();
+    }
+    Enable_Exceptions();
+}
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Return how many of the next Max ticks have no alarm expiry nor wheel cascade, called with the interrupts masked */
+static uint8 Os_AlarmFreeTicks(uint8 Max)
+{
+    uint32 tick = g_Alarm_Time;
+    uint8 free_ticks = 0;
+
+    while(free_ticks < Max)
+    {
+        tick++;
+        if(((tick & OS_ALARM_WHEEL_MASK) == 0) || (g_Alarm_Wheel[tick & OS_ALARM_WHEEL_MASK] != OS_ALARM_NONE))
+        {
+            break;
+        }
+        free_ticks++;
+    }
+
+    return free_ticks;
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_SetRelAlarm(Os_AlarmType AlarmId, uint32 Increment, uint32 Cycle, Os_AlarmCallbackType Callback)
+{
+    Std_ReturnType status = E_NOT_OK;
+
+    if((AlarmId < OS_ALARMS_NUM) && (Increment != 0) && (Callback != NULL_PTR))
+    {
+        Disable_Exceptions();
+        if(g_Alarms[AlarmId].Slot == OS_ALARM_NONE)
+        {
+            g_Alarms[AlarmId].Expiry   = g_Alarm_Time + Increment;
+            g_Alarms[AlarmId].Cycle    = Cycle;
+            g_Alarms[AlarmId].Callback = Callback;
+            Os_AlarmInsert(AlarmId);
+            status = E_OK;
+        }
+        Enable_Exceptions();
+    }
+
+    return status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_CancelAlarm(Os_AlarmType AlarmId)
+{
+    Std_ReturnType status = E_NOT_OK;
+
+    if(AlarmId < OS_ALARMS_NUM)
+    {
+        Disable_Exceptions();
+        if(g_Alarms[AlarmId].Slot != OS_ALARM_NONE)
+        {
+            Os_AlarmRemove(AlarmId);
+            status = E_OK;
+        }
+        Enable_Exceptions();
+    }
+
+    return status;
+}
+#endif
+
+#if (OS_DEFERRED_WORK == STD_ON)
+/*********************************************************************************************/
+/* Description: Return TRUE if a deferred work item waits and the budget of the current tick is not used up */
+static boolean Os_DeferredWorkReady(void)
+{
+    if(g_Deferred_Work_Head == g_Deferred_Work_Tail)
+    {
+        return FALSE;
+    }
+
+    /* A new tick renews the budget */
+    if(g_Deferred_Work_Tick != g_Timer_Ticks)
+    {
+        g_Deferred_Work_Tick  = g_Timer_Ticks;
+        g_Deferred_Work_Spent = 0;
+    }
+
+    return (g_Deferred_Work_Spent < OS_DEFERRED_WORK_BUDGET) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Run the oldest deferred work item and charge its time to the budget of the tick */
+static void Os_RunDeferredWork(void)
+{
+    uint16 tail = g_Deferred_Work_Tail;
+    Os_DeferredWorkItemType item = g_Deferred_Work[tail & (OS_DEFERRED_WORK_QUEUE_LENGTH - 1U)];
+    uint32 start;
+
+    /* Release the slot before running so the item can post again */
+    g_Deferred_Work_Tail = tail + 1U;
+
+    start = Os_GetTimeUs();
+    item.Func(item.Context);
+    g_Deferred_Work_Spent += Os_GetTimeUs() - start;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_PostDeferredWork(Os_DeferredWorkFuncType Func, void * Context)
+{
+    uint16 head;
+    Std_ReturnType status = E_NOT_OK;
+
+    if(Func == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Several producers ... reserve the slot and publish it in one short critical section */
+    Disable_Exceptions();
+    head = g_Deferred_Work_Head;
+    if((uint16)(head - g_Deferred_Work_Tail) < OS_DEFERRED_WORK_QUEUE_LENGTH)
+    {
+        g_Deferred_Work[head & (OS_DEFERRED_WORK_QUEUE_LENGTH - 1U)].Func    = Func;
+        g_Deferred_Work[head & (OS_DEFERRED_WORK_QUEUE_LENGTH - 1U)].Context = Context;
+        g_Deferred_Work_Head = head + 1U;
+        status = E_OK;
+    }
+    else
+    {
+        g_Deferred_Work_Drops++;
+    }
+    Enable_Exceptions();
+
+    return status;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetDeferredWorkDropCount(void)
+{
+    return g_Deferred_Work_Drops;
+}
+#endif
+
+#if (OS_IDLE_SLEEP == STD_ON)
+/*********************************************************************************************/
+/* Description: Called by the scheduler when nothing is due, sleep until the next interrupt and account the idle time */
+static void Os_IdleHook(void)
+{
+    uint32 sleep_start;
+    uint32 sleep_end;
+#if (OS_TICKLESS_IDLE == STD_ON)
+    uint32 period;
+    uint32 ticks_ahead;
+    uint8 suppressed_ticks = 0;
+#endif
+
+    /*
+     * Mask the interrupts while checking the flags, a tick or an event arriving between the check and the WFI
+     * stays pending and wakes the core up immediately instead of being lost for a whole period
+     */
+    Disable_Exceptions();
+#if (OS_DEFERRED_WORK == STD_ON)
+    /* Deferred work posted by an interrupt since the check of the scheduler keeps the core awake */
+    if((g_Timer_Ticks == g_Processed_Ticks) && (g_Event_Set == FALSE) && (Os_DeferredWorkReady() == FALSE))
+#else
+    if((g_Timer_Ticks == g_Processed_Ticks) && (g_Event_Set == FALSE))
+#endif
+    {
+#if (OS_TICKLESS_IDLE == STD_ON)
+        /* Stretch the current period over the following ticks that have nothing to release */
+        period = SysTick_GetTimeElapsed() + SysTick_GetTimeRemaining() + 1;
+        /* A mode or task change waits for the next tick */
+        suppressed_ticks = (g_Requests_Pending == TRUE) ? 0 : (g_Schedule_Next[g_App_Mode][g_Time_Tick_Count] - 1);
+#if (OS_DEFERRED_WORK == STD_ON)
+        /* Deferred work waiting for the budget of the next tick */
+        if(g_Deferred_Work_Head != g_Deferred_Work_Tail)
+        {
+            suppressed_ticks = 0;
+        }
+#endif
+        if(suppressed_ticks > ((SYSTICK_MAX_RELOAD_VALUE / period) - 1))
+        {
+            suppressed_ticks = (SYSTICK_MAX_RELOAD_VALUE / period) - 1;
+        }
+#if (OS_ALARM_SERVICE == STD_ON)
+        /* Wake up for the next alarm expiry too */
+        suppressed_ticks = Os_AlarmFreeTicks(suppressed_ticks);
+#endif
+        if((suppressed_ticks != 0) && (SysTick_AdjustTimeRemaining((sint32)(suppressed_ticks * period)) != E_OK))
+        {
+            suppressed_ticks = 0;
+        }
+#endif
+
+        sleep_start = SysTick_GetTimeRemaining();
+        Wait_For_Interrupt();
+        sleep_end   = SysTick_GetTimeRemaining();
+
+        if(SysTick_IsInterruptPending() == TRUE)
+        {
+            /* The timer expired during the sleep and reloaded the normal period */
+            g_Idle_Time_Accumulator += sleep_start + SysTick_GetTimeElapsed() + 1;
+#if (OS_TICKLESS_IDLE == STD_ON)
+            /* The pending interrupt accounts for the last tick */
+            Os_StepTick(suppressed_ticks);
+#endif
+        }
+        else
+        {
+            g_Idle_Time_Accumulator += sleep_start - sleep_end;
+#if (OS_TICKLESS_IDLE == STD_ON)
+            /* Woken up early by another interrupt ... cut the stretched period at the next tick boundary */
+            if(suppressed_ticks != 0)
+            {
+                ticks_ahead = sleep_end / period;
+                if((ticks_ahead != 0) && (SysTick_AdjustTimeRemaining(-(sint32)(ticks_ahead * period)) != E_OK))
+                {
+                    ticks_ahead = 0;
+                }
+                Os_StepTick(suppressed_ticks - (uint8)ticks_ahead);
+            }
+#endif
+        }
+    }
+    /* The pending interrupt is served here */
+    Enable_Exceptions();
+}
+
+/*********************************************************************************************/
+/* Description: Called at the start of every hyperperiod to publish the idle/busy time of the previous one */
+static void Os_LatchIdleTime(void)
+{
+    /* Elapsed + Remaining + 1 is the timer period in counts */
+    uint32 hyperperiod_time = OS_HYPERPERIOD_TICKS * (SysTick_GetTimeElapsed() + SysTick_GetTimeRemaining() + 1);
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+    uint16 load;
+#endif
+
+    g_Idle_Time = g_Idle_Time_Accumulator;
+    g_Busy_Time = (hyperperiod_time > g_Idle_Time) ? (hyperperiod_time - g_Idle_Time) : 0;
+    g_Idle_Time_Accumulator = 0;
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+    load = (uint16)(((uint64)g_Busy_Time * OS_CPU_LOAD_FULL) / hyperperiod_time);
+
+    /* Exponential moving average ... avg += (load - avg) / 2^n, seeded with the first hyperperiod */
+    if(g_Cpu_Load_Average_Scaled == 0)
+    {
+        g_Cpu_Load_Average_Scaled = (uint32)load << OS_CPU_LOAD_AVERAGE_SHIFT;
+    }
+    else
+    {
+        g_Cpu_Load_Average_Scaled = g_Cpu_Load_Average_Scaled - (g_Cpu_Load_Average_Scaled >> OS_CPU_LOAD_AVERAGE_SHIFT) + load;
+    }
+
+    g_Cpu_Load.Current = load;
+    g_Cpu_Load.Average = (uint16)(g_Cpu_Load_Average_Scaled >> OS_CPU_LOAD_AVERAGE_SHIFT);
+    if(load > g_Cpu_Load.Peak)
+    {
+        g_Cpu_Load.Peak = load;
+    }
+    if(load > OS_CPU_LOAD_LIMIT)
+    {
+        g_Cpu_Load.Overloads++;
+    }
+#endif
+}
+
+/*********************************************************************************************/
+uint32 Os_GetIdleTime(void)
+{
+    return g_Idle_Time;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetBusyTime(void)
+{
+    return g_Busy_Time;
+}
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+/*********************************************************************************************/
+void Os_GetCpuLoad(Os_CpuLoadType * Load)
+{
+    /* Take a consistent copy, the load may be updated from the tick interrupt in the preemptive mode */
+    Disable_Exceptions();
+    Load->Current   = g_Cpu_Load.Current;
+    Load->Peak      = g_Cpu_Load.Peak;
+    Load->Average   = g_Cpu_Load.Average;
+    Load->Overloads = g_Cpu_Load.Overloads;
+    Enable_Exceptions();
+}
+
+/*********************************************************************************************/
+void Os_ResetCpuLoadPeak(void)
+{
+    Disable_Exceptions();
+    g_Cpu_Load.Peak      = 0;
+    g_Cpu_Load.Overloads = 0;
+    Enable_Exceptions();
+}
+#endif
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/*********************************************************************************************/
+/* Description: Add one run of a task to its statistics */
+static void Os_RecordTaskTime(Os_TaskType Task, uint32 ExecutionTime, uint32 ResponseTime)
+{
+    Os_TaskTimeRecordType * record = &g_Task_Time[Task];
+
+    if((record->Activations == 0) || (ExecutionTime < record->MinExecutionTime))
+    {
+        record->MinExecutionTime = ExecutionTime;
+    }
+    if(ExecutionTime > record->MaxExecutionTime)
+    {
+        record->MaxExecutionTime = ExecutionTime;
+    }
+    if((record->Activations == 0) || (ResponseTime < record->MinResponseTime))
+    {
+        record->MinResponseTime = ResponseTime;
+    }
+    if(ResponseTime > record->MaxResponseTime)
+    {
+        record->MaxResponseTime = ResponseTime;
+    }
+
+    record->SumExecutionTime += ExecutionTime;
+    record->SumResponseTime  += ResponseTime;
+    record->Activations++;
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Return the cycle counter at the interrupt of the tick being processed */
+static uint32 Os_TickReleaseStamp(void)
+{
+    uint32 timer_ticks;
+    uint32 stamp;
+
+    /* Retry in case the tick interrupt updated the counter and the stamp between the reads */
+    do
+    {
+        timer_ticks = g_Timer_Ticks;
+        stamp       = g_Tick_Stamp;
+    } while(timer_ticks != g_Timer_Ticks);
+
+    /* The stamp belongs to the latest tick ... go back over the ticks that arrived after the processed one */
+    return stamp - ((timer_ticks - g_Processed_Ticks - 1U) * g_Tick_Cycles);
+}
+#endif
+
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+/*********************************************************************************************/
+/* Description: Return the log2 histogram bucket of a value in cycles */
+static uint8 Os_HistogramBucket(uint32 Cycles)
+{
+    uint32 bucket = 32U - Os_CountLeadingZeros(Cycles);
+
+    return (uint8)((bucket < OS_HISTOGRAM_BUCKETS) ? bucket : (OS_HISTOGRAM_BUCKETS - 1U));
+}
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt after the stamp to record the deviation from the tick grid */
+static void Os_RecordTickJitter(void)
+{
+    /* The tickless idle may count several ticks for one interrupt */
+    uint32 expected = (g_Timer_Ticks - g_Jitter_Last_Tick) * g_Tick_Cycles;
+    uint32 interval = g_Tick_Stamp - g_Jitter_Last_Stamp;
+
+    /* The first tick has no previous one */
+    if(g_Jitter_Last_Tick != 0)
+    {
+        g_Tick_Jitter_Histogram[Os_HistogramBucket((interval > expected) ? (interval - expected) : (expected - interval))]++;
+    }
+
+    g_Jitter_Last_Tick  = g_Timer_Ticks;
+    g_Jitter_Last_Stamp = g_Tick_Stamp;
+}
+
+/*********************************************************************************************/
+void Os_GetTickJitterHistogram(uint32 * Histogram)
+{
+    uint8 bucket;
+
+    for(bucket = 0; bucket < OS_HISTOGRAM_BUCKETS; bucket++)
+    {
+        Histogram[bucket] = g_Tick_Jitter_Histogram[bucket];
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetDispatchLatencyHistogram(Os_TaskType TaskId, uint32 * Histogram)
+{
+    uint8 bucket;
+
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        return E_NOT_OK;
+    }
+
+    for(bucket = 0; bucket < OS_HISTOGRAM_BUCKETS; bucket++)
+    {
+        Histogram[bucket] = g_Dispatch_Latency_Histogram[TaskId][bucket];
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_ResetHistograms(void)
+{
+    Os_TaskType task;
+    uint8 bucket;
+
+    Disable_Exceptions();
+    for(bucket = 0; bucket < OS_HISTOGRAM_BUCKETS; bucket++)
+    {
+        g_Tick_Jitter_Histogram[bucket] = 0;
+        for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+        {
+            g_Dispatch_Latency_Histogram[task][bucket] = 0;
+        }
+    }
+    Enable_Exceptions();
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskTimeStats(Os_TaskType TaskId, Os_TaskTimeStatsType * Stats)
+{
+    Os_TaskTimeRecordType record;
+
+    if((TaskId >= OS_CONFIGURED_TASKS) || (Stats == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    /* Take a consistent copy, the record may be updated from the tick interrupt */
+    Disable_Exceptions();
+    record = g_Task_Time[TaskId];
+    Enable_Exceptions();
+
+    Stats->MinExecutionTime = record.MinExecutionTime;
+    Stats->MaxExecutionTime = record.MaxExecutionTime;
+    Stats->MinResponseTime  = record.MinResponseTime;
+    Stats->MaxResponseTime  = record.MaxResponseTime;
+    Stats->Activations      = record.Activations;
+    if(record.Activations != 0)
+    {
+        Stats->AvgExecutionTime = (uint32)(record.SumExecutionTime / record.Activations);
+        Stats->AvgResponseTime  = (uint32)(record.SumResponseTime / record.Activations);
+    }
+    else
+    {
+        Stats->AvgExecutionTime = 0;
+        Stats->AvgResponseTime  = 0;
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_ResetTaskTimeStats(void)
+{
+    Os_TaskType task;
+
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        Disable_Exceptions();
+        g_Task_Time[task].MaxExecutionTime = 0;
+        g_Task_Time[task].SumExecutionTime = 0;
+        g_Task_Time[task].MaxResponseTime  = 0;
+        g_Task_Time[task].SumResponseTime  = 0;
+        g_Task_Time[task].Activations      = 0;
+        Enable_Exceptions();
+    }
+}
+
+/*********************************************************************************************/
+uint32 Os_GetInitTaskTime(void)
+{
+    return g_Init_Task_Time;
+}
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/*********************************************************************************************/
+/* Description: Return TRUE and clear the request if the release must be skipped after an ignored budget violation */
+static boolean Os_SkipRelease(Os_TaskType Task)
+{
+    if(g_Budget_Skip[Task] == TRUE)
+    {
+        g_Budget_Skip[Task] = FALSE;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+#ifndef OS_HOST_BUILD
+/*********************************************************************************************/
+/* Description: Stop a task that exceeded its budget, entered in the thread mode instead of the task code */
+static void Os_KillTask(Os_TaskType Task)
+{
+#if (OS_RESOURCES == STD_ON)
+    /* Release the resources in the reverse order, the last release restores the BASEPRI of the task start */
+    while(g_Resource_Last != OS_RESOURCE_NONE)
+    {
+        (void)Os_ReleaseResource(g_Resource_Last);
+    }
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_TaskTerminate(Task);
+#else
+    (void)Task;
+    longjmp(g_Task_Kill_Context, 1);
+#endif
+}
+
+/*********************************************************************************************/
+void Os_TimingProtection(uint32 * Frame, uint32 ExcReturn)
+{
+    Os_TaskType task = g_Budget_Task;
+
+    Timer0A_ClearInterrupt();
+
+    /* The task completed or was switched out meanwhile */
+    if(task == OS_NO_TASK)
+    {
+        return;
+    }
+
+    /* An interrupt preempted the task ... stop the task once the interrupt returns to it */
+    if((ExcReturn & OS_EXC_RETURN_THREAD_MASK) == 0)
+    {
+        Timer0A_StartOneShot(OS_PROTECTION_RETRY_COUNTS);
+        return;
+    }
+
+    g_Budget_Task = OS_NO_TASK;
+    g_Budget_Violations[task]++;
+    (void)Det_ReportRuntimeError(OS_MODULE_ID, OS_INSTANCE_ID, OS_TIMING_PROTECTION_SID, OS_E_PROTECTION_TIME);
+
+    if(Os_ProtectionHook(task) == OS_PRO_IGNORE)
+    {
+        g_Budget_Skip[task] = TRUE;
+    }
+    else
+    {
+        /* Return to Os_KillTask(task) instead of the task code, the IT state is cleared with the new PC */
+        Frame[OS_EXC_FRAME_R0]   = task;
+        Frame[OS_EXC_FRAME_PC]   = (uint32)Os_KillTask & ~1U;
+        Frame[OS_EXC_FRAME_XPSR] = (Frame[OS_EXC_FRAME_XPSR] & OS_XPSR_ALIGN_MASK) | OS_XPSR_THUMB;
+    }
+}
+#endif
+
+/*********************************************************************************************/
+uint16 Os_GetBudgetViolationCount(Os_TaskType TaskId)
+{
+    return (TaskId < OS_CONFIGURED_TASKS) ? g_Budget_Violations[TaskId] : 0;
+}
+#endif
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Run a task function to completion, or until its budget expires if the timing protection is on */
+static void Os_RunTask(Os_TaskType Task)
+{
+#if (OS_TIMING_PROTECTION == STD_ON) && !defined(OS_HOST_BUILD)
+    if(g_Budget_Counts[Task] == 0)
+    {
+        Os_Configuration.Tasks[Task].TaskFunc();
+    }
+    else if(setjmp(g_Task_Kill_Context) == 0)
+    {
+        g_Budget_Task = Task;
+        Timer0A_StartOneShot(g_Budget_Counts[Task]);
+        Os_Configuration.Tasks[Task].TaskFunc();
+        g_Budget_Task = OS_NO_TASK;
+        (void)Timer0A_Stop();
+    }
+    else
+    {
+        /* Stopped by Os_KillTask */
+    }
+#else
+    Os_Configuration.Tasks[Task].TaskFunc();
+#endif
+}
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+/* Description: Select the highest priority ready context and request a PendSV if it is not the running one,
+ *              called with the interrupts masked */
+static void Os_Dispatch(void)
+{
+#if (OS_RESOURCES == STD_ON)
+    uint32 ready = g_Ready_Mask | g_Ceiling_Mask;
+    uint32 priority;
+
+    if(ready == 0)
+    {
+        g_Next_Context = OS_IDLE_CONTEXT;
+    }
+    else
+    {
+        /* A held task ceiling outranks the ready tasks up to it, its holder keeps the CPU */
+        priority = 31U - Os_CountLeadingZeros(ready);
+        g_Next_Context = (((g_Ceiling_Mask >> priority) & 1U) != 0) ? g_Ceiling_Task[priority] : g_Priority_Task[priority];
+    }
+#else
+    if(g_Ready_Mask == 0)
+    {
+        g_Next_Context = OS_IDLE_CONTEXT;
+    }
+    else
+    {
+        /* Count leading zeros gives the highest set bit in one instruction */
+        g_Next_Context = g_Priority_Task[31U - Os_CountLeadingZeros(g_Ready_Mask)];
+    }
+#endif
+
+    if((g_Preemption_Started == TRUE) && (g_Next_Context != g_Running_Context))
+    {
+        NVIC_SYSTEM_INTCTRL = PENDSV_SET_MASK;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Mark a task released in this tick as ready, called with the interrupts masked */
+static void Os_ReleaseTask(Os_TaskType Task)
+{
+    uint32 priority_bit = (uint32)1 << Os_Configuration.Tasks[Task].Priority;
+
+    /* The previous release is still ready or running */
+    if((g_Ready_Mask & priority_bit) != 0)
+    {
+        g_Task_Overrun_Count[Task]++;
+    }
+#if (OS_TIMING_PROTECTION == STD_ON)
+    else if(Os_SkipRelease(Task) == TRUE)
+    {
+        /* Release dropped after a budget violation */
+    }
+#endif
+    else
+    {
+        g_Ready_Mask |= priority_bit;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        g_Task_Release_Stamp[Task] = Os_ReadCycleCounter();
+#endif
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Entry point of every task context, run the task function once then terminate */
+static void Os_TaskEntry(Os_TaskType Task)
+{
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+    /* First instruction of the task context */
+    g_Dispatch_Latency_Histogram[Task][Os_HistogramBucket(Os_ReadCycleCounter() - g_Task_Release_Stamp[Task])]++;
+#endif
+
+    Os_Configuration.Tasks[Task].TaskFunc();
+
+    Os_TaskTerminate(Task);
+}
+
+/*********************************************************************************************/
+/* Description: Record the completed run, clear the ready bit (or keep it for a pending activation) and switch away */
+static void Os_TaskTerminate(Os_TaskType Task)
+{
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    uint32 end;
+#endif
+
+    Disable_Exceptions();
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    end = Os_ReadCycleCounter();
+    Os_RecordTaskTime(Task, g_Task_Run_Cycles[Task] + (end - g_Switch_Stamp), end - g_Task_Release_Stamp[Task]);
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* The activation pending after an ignored budget violation is the skipped release */
+    if((g_Event_Pending[Task] == TRUE) && (Os_SkipRelease(Task) == TRUE))
+    {
+        g_Event_Pending[Task] = FALSE;
+    }
+#endif
+    if(g_Event_Pending[Task] == TRUE)
+    {
+        /* Activated while running ... stay ready and run again */
+        g_Event_Pending[Task] = FALSE;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        g_Task_Release_Stamp[Task] = g_Task_Event_Stamp[Task];
+#endif
+    }
+    else
+    {
+        g_Ready_Mask &= ~((uint32)1 << Os_Configuration.Tasks[Task].Priority);
+    }
+    g_Context_Started[Task] = FALSE;
+    Os_Dispatch();
+
+    /* Always switch, a task released again meanwhile restarts from a new frame */
+    NVIC_SYSTEM_INTCTRL = PENDSV_SET_MASK;
+    Enable_Exceptions();
+
+    /* The PendSV switches away and never returns to this context */
+    while(1)
+    {
+
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Prepare the initial frame so the first switch to the context starts its entry function */
+static void Os_BuildFrame(uint8 Context)
+{
+    uint32 * sp;
+
+    if(Context == OS_IDLE_CONTEXT)
+    {
+        sp = &g_Idle_Stack[OS_IDLE_STACK_SIZE / 4U] - OS_CONTEXT_FRAME_WORDS;
+        sp[OS_FRAME_PC] = (uint32)Os_Scheduler & ~1U;
+    }
+    else
+    {
+        sp = &g_Task_Stacks[Context][OS_TASK_STACK_SIZE / 4U] - OS_CONTEXT_FRAME_WORDS;
+        sp[OS_FRAME_PC] = (uint32)Os_TaskEntry & ~1U;
+    }
 
-/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
-#define Enable_Faults()        __asm(" CPSIE F ")
+    sp[OS_FRAME_EXC_RETURN] = OS_INITIAL_EXC_RETURN;
+    sp[OS_FRAME_R0]         = Context;
+    sp[OS_FRAME_LR]         = 0;
+    sp[OS_FRAME_XPSR]       = OS_INITIAL_XPSR;
 
-/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
-#define Disable_Faults()       __asm(" CPSID F ")
+    g_Context_Sp[Context]      = sp;
+    g_Context_Started[Context] = TRUE;
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+    if(Context != OS_IDLE_CONTEXT)
+    {
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        g_Task_Run_Cycles[Context] = 0;
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+        /* Every run starts with the full budget */
+        g_Budget_Remaining[Context] = g_Budget_Counts[Context];
+#endif
+    }
+}
+
+/*********************************************************************************************/
+uint32 * Os_SwitchContext(uint32 * Sp)
+{
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    uint32 now = Os_ReadCycleCounter();
+
+    /* Account the cycles of the task switched out */
+    if(g_Running_Context < OS_CONFIGURED_TASKS)
+    {
+        g_Task_Run_Cycles[g_Running_Context] += now - g_Switch_Stamp;
+    }
+    g_Switch_Stamp = now;
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* The budget of the task switched out stops until it runs again */
+    if(g_Budget_Task != OS_NO_TASK)
+    {
+        g_Budget_Remaining[g_Budget_Task] = Timer0A_Stop();
+        g_Budget_Task = OS_NO_TASK;
+    }
+#endif
+
+    if(g_Running_Context != OS_NO_CONTEXT)
+    {
+        g_Context_Sp[g_Running_Context] = Sp;
+    }
+
+    /* A context that is not started (or already terminated) starts again from its entry function */
+    if(g_Context_Started[g_Next_Context] == FALSE)
+    {
+        Os_BuildFrame(g_Next_Context);
+    }
+
+    g_Running_Context = g_Next_Context;
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* Count the rest of the budget of the task switched in, an expired one stops it at once */
+    if((g_Running_Context < OS_CONFIGURED_TASKS) && (g_Budget_Counts[g_Running_Context] != 0)
+            && (g_Budget_Skip[g_Running_Context] == FALSE))
+    {
+        g_Budget_Task = g_Running_Context;
+        Timer0A_StartOneShot((g_Budget_Remaining[g_Running_Context] == 0) ? 1U : g_Budget_Remaining[g_Running_Context]);
+    }
+#endif
+
+    return g_Context_Sp[g_Running_Context];
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Take the requested application mode and task states into use */
+static void Os_ApplyRequests(void)
+{
+    Os_TaskType task;
+
+    /* Cleared first so a request arriving during the copy is applied at the next tick */
+    g_Requests_Pending = FALSE;
+    g_App_Mode = g_App_Mode_Request;
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        g_Task_Disabled[task] = g_Task_Disable_Request[task];
+    }
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Run one release of a task due in the processed tick, return FALSE if the release was dropped */
+static boolean Os_StartRelease(Os_TaskType Task)
+{
+    if(g_Task_Disabled[Task] == TRUE)
+    {
+        return FALSE;
+    }
+#if (OS_TIMING_PROTECTION == STD_ON)
+    if(Os_SkipRelease(Task) == TRUE)
+    {
+        return FALSE;
+    }
+#endif
+
+    Os_RunTask(Task);
+    return TRUE;
+}
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/*********************************************************************************************/
+/* Description: Add one release of the processed tick running from Start to End (cycle counter) to the task statistics */
+static void Os_RecordRelease(Os_TaskType Task, uint32 Start, uint32 End)
+{
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+    g_Dispatch_Latency_Histogram[Task][Os_HistogramBucket(Start - g_Tick_Release_Stamp)]++;
+#endif
+    Os_RecordTaskTime(Task, End - Start, End - g_Tick_Release_Stamp);
+}
+#endif
+
+#ifndef OS_HOST_BUILD
+/*********************************************************************************************/
+/* Description: Run one release of a task due in the processed tick and record its times */
+static void Os_RunRelease(Os_TaskType Task)
+{
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    uint32 start = Os_ReadCycleCounter();
+
+    if(Os_StartRelease(Task) == TRUE)
+    {
+        Os_RecordRelease(Task, start, Os_ReadCycleCounter());
+    }
+#else
+    (void)Os_StartRelease(Task);
+#endif
+}
+#endif
+#endif
+
+/*********************************************************************************************/
+/* Description: Move the Os time to the next tick and run its releases if Dispatch is TRUE */
+static void Os_ProcessTick(boolean Dispatch)
+{
+    uint8 tick;
+    Os_ScheduleIndexType entry;
+    Os_ScheduleIndexType last_entry;
+    Os_TaskType task;
+#if (OS_PREEMPTIVE == STD_OFF) && !defined(OS_HOST_BUILD)
+    uint32 timer_ticks;
+#endif
+
+    /* Move to the next tick and wrap at the end of the hyperperiod */
+    g_Time_Tick_Count++;
+    if(g_Time_Tick_Count == OS_HYPERPERIOD_TICKS)
+    {
+        g_Time_Tick_Count = 0;
+    }
+    tick = g_Time_Tick_Count;
+
+    /* The mode and task changes take effect at the tick boundary */
+    if(g_Requests_Pending == TRUE)
+    {
+        Os_ApplyRequests();
+    }
+
+#if (OS_IDLE_SLEEP == STD_ON)
+    if(tick == 0)
+    {
+        Os_LatchIdleTime();
+    }
+#endif
+
+    if(Dispatch == TRUE)
+    {
+        /* Dispatch only the tasks released in this tick */
+        entry       = g_Schedule_Start[g_App_Mode][tick];
+        last_entry  = g_Schedule_Start[g_App_Mode][tick + 1];
+#if (OS_PREEMPTIVE == STD_ON)
+        for(; entry < last_entry; entry++)
+        {
+            task = g_Schedule_Tasks[entry];
+            if(g_Task_Disabled[task] == FALSE)
+            {
+                Os_ReleaseTask(task);
+            }
+        }
+#else
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        g_Tick_Release_Stamp = Os_TickReleaseStamp();
+#endif
+#ifdef OS_HOST_BUILD
+        /* The host build shards the releases of the tick over its worker threads and records their times in schedule order */
+        (void)task;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        Os_HostRunReleases(&g_Schedule_Tasks[entry], (uint16)(last_entry - entry), Os_StartRelease, Os_RecordRelease);
+#else
+        Os_HostRunReleases(&g_Schedule_Tasks[entry], (uint16)(last_entry - entry), Os_StartRelease, NULL_PTR);
+#endif
+#else
+        timer_ticks = g_Timer_Ticks;
+        for(; entry < last_entry; entry++)
+        {
+            task = g_Schedule_Tasks[entry];
+            Os_RunRelease(task);
+
+            /* A new tick arrived while this task was running */
+            if(g_Timer_Ticks != timer_ticks)
+            {
+                timer_ticks = g_Timer_Ticks;
+                g_Task_Overrun_Count[task]++;
+            }
+        }
+#endif
+#endif
+    }
+
+    g_Processed_Ticks++;
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Run the tasks activated by Os_SetEvent since the last call in the task table order */
+static void Os_DispatchEvents(void)
+{
+    Os_TaskType task;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    uint32 start;
+    uint32 end;
+#endif
+
+    g_Event_Set = FALSE;
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        if(g_Event_Pending[task] == TRUE)
+        {
+            /* Clear before running so an activation during the run is kept for the next dispatch */
+            g_Event_Pending[task] = FALSE;
+#if (OS_TIMING_PROTECTION == STD_ON)
+            if(Os_SkipRelease(task) == TRUE)
+            {
+                continue;
+            }
+#endif
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+            start = Os_ReadCycleCounter();
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+            g_Dispatch_Latency_Histogram[task][Os_HistogramBucket(start - g_Task_Event_Stamp[task])]++;
+#endif
+            Os_RunTask(task);
+            end   = Os_ReadCycleCounter();
+            Os_RecordTaskTime(task, end - start, end - g_Task_Event_Stamp[task]);
+#else
+            Os_RunTask(task);
+#endif
+        }
+    }
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    uint32 priority_bit;
+#endif
+
+    if((TaskId >= OS_CONFIGURED_TASKS) || (g_Task_Disabled[TaskId] == TRUE))
+    {
+        return E_NOT_OK;
+    }
+
+#if (OS_PREEMPTIVE == STD_ON)
+    priority_bit = (uint32)1 << Os_Configuration.Tasks[TaskId].Priority;
+
+    Disable_Exceptions();
+    if((g_Ready_Mask & priority_bit) != 0)
+    {
+        /* Already ready or running ... run once more when it completes */
+        if(g_Event_Pending[TaskId] == FALSE)
+        {
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+            g_Task_Event_Stamp[TaskId] = Os_ReadCycleCounter();
+#endif
+            g_Event_Pending[TaskId] = TRUE;
+        }
+    }
+#if (OS_TIMING_PROTECTION == STD_ON)
+    else if(Os_SkipRelease(TaskId) == TRUE)
+    {
+        /* Activation dropped after a budget violation */
+    }
+#endif
+    else
+    {
+        g_Ready_Mask |= priority_bit;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        g_Task_Release_Stamp[TaskId] = Os_ReadCycleCounter();
+#endif
+        Os_Dispatch();
+    }
+    Enable_Exceptions();
+#else
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    /* The response time counts from the first activation of the run */
+    if(g_Event_Pending[TaskId] == FALSE)
+    {
+        g_Task_Event_Stamp[TaskId] = Os_ReadCycleCounter();
+    }
+#endif
+    g_Event_Pending[TaskId] = TRUE;
+    g_Event_Set = TRUE;
+#endif
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_SetApplicationMode(Os_AppModeType Mode)
+{
+    if(Mode >= OS_CONFIGURED_APP_MODES)
+    {
+        return E_NOT_OK;
+    }
+
+    g_App_Mode_Request = Mode;
+    g_Requests_Pending = TRUE;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Os_AppModeType Os_GetActiveApplicationMode(void)
+{
+    return g_App_Mode;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId)
+{
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        return E_NOT_OK;
+    }
+
+    g_Task_Disable_Request[TaskId] = FALSE;
+    g_Requests_Pending             = TRUE;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_DisableTask(Os_TaskType TaskId)
+{
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        return E_NOT_OK;
+    }
+
+    g_Task_Disable_Request[TaskId] = TRUE;
+    g_Requests_Pending             = TRUE;
+
+    return E_OK;
+}
+
+#if (OS_QUEUE_SERVICE == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_QueueInit(Os_QueueType * Queue, uint8 * Buffer, uint16 Length, uint16 ElementSize)
+{
+    if((Queue == NULL_PTR) || (Buffer == NULL_PTR) || (ElementSize == 0)
+            || (Length == 0) || (Length > 0x8000U) || ((Length & (Length - 1U)) != 0))
+    {
+        return E_NOT_OK;
+    }
+
+    Queue->Head        = 0;
+    Queue->Tail        = 0;
+    Queue->Length      = Length;
+    Queue->ElementSize = ElementSize;
+    Queue->Buffer      = Buffer;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_QueueSend(Os_QueueType * Queue, const void * Data)
+{
+    uint16 head = Queue->Head;
+    uint16 index;
+    volatile uint8 * element;
+    const uint8 * source = (const uint8 *)Data;
+
+    /* Full ... Tail is only advanced by the consumer so the free space can only grow meanwhile */
+    if((uint16)(head - Queue->Tail) >= Queue->Length)
+    {
+        return E_NOT_OK;
+    }
+
+    element = &Queue->Buffer[(uint32)(head & (Queue->Length - 1U)) * Queue->ElementSize];
+    for(index = 0; index < Queue->ElementSize; index++)
+    {
+        element[index] = source[index];
+    }
+
+    /*
+     * Publish the element ... all the accesses are volatile so the compiler keeps the order and the
+     * Cortex-M4 does not reorder them as seen by the interrupts of the same core
+     */
+    Queue->Head = head + 1U;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_QueueReceive(Os_QueueType * Queue, void * Data)
+{
+    uint16 tail = Queue->Tail;
+    uint16 index;
+    volatile uint8 * element;
+    uint8 * destination = (uint8 *)Data;
+
+    /* Empty ... Head is only advanced by the producer */
+    if(tail == Queue->Head)
+    {
+        return E_NOT_OK;
+    }
+
+    element = &Queue->Buffer[(uint32)(tail & (Queue->Length - 1U)) * Queue->ElementSize];
+    for(index = 0; index < Queue->ElementSize; index++)
+    {
+        destination[index] = element[index];
+    }
+
+    /* Release the slot to the producer only after the copy */
+    Queue->Tail = tail + 1U;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+uint16 Os_QueueCount(const Os_QueueType * Queue)
+{
+    return (uint16)(Queue->Head - Queue->Tail);
+}
+#endif
+
+#if (OS_RESOURCES == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetResource(Os_ResourceType ResId)
+{
+    uint32 previous;
+
+    if(ResId >= OS_CONFIGURED_RESOURCES)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Raise first ... from here no interrupt using the resource can run (a ceiling of 0 leaves BASEPRI unchanged) */
+    previous = Os_RaiseBasepri((uint32)Os_Configuration.Resources[ResId].Ceiling << OS_BASEPRI_BITS_POS);
+
+    if(g_Resource_Locked[ResId] == TRUE)
+    {
+        Os_SetBasepri(previous);
+        return E_NOT_OK;
+    }
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* The holder runs at the task ceiling, the tasks above it still preempt it and restore the mask before it resumes */
+    g_Resource_Saved_Ceiling_Mask[ResId] = g_Ceiling_Mask;
+    g_Ceiling_Task[Os_Configuration.Resources[ResId].TaskCeiling] = g_Running_Context;
+    g_Ceiling_Mask |= (uint32)1 << Os_Configuration.Resources[ResId].TaskCeiling;
+#endif
+
+    g_Resource_Locked[ResId]        = TRUE;
+    g_Resource_Saved_Basepri[ResId] = previous;
+    g_Resource_Previous[ResId]      = g_Resource_Last;
+    g_Resource_Last                 = ResId;
+
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId)
+{
+    if((ResId >= OS_CONFIGURED_RESOURCES) || (g_Resource_Last != ResId))
+    {
+        return E_NOT_OK;
+    }
+
+    g_Resource_Last          = g_Resource_Previous[ResId];
+    g_Resource_Locked[ResId] = FALSE;
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Back to the previous ceiling, a task held off by this one is dispatched now */
+    Disable_Exceptions();
+    g_Ceiling_Mask = g_Resource_Saved_Ceiling_Mask[ResId];
+    Os_Dispatch();
+    Enable_Exceptions();
+#endif
+
+    /* Lower last ... a preemption pending on the resource runs right after this write */
+    Os_SetBasepri(g_Resource_Saved_Basepri[ResId]);
+
+    return E_OK;
+}
+#endif
+
+/*********************************************************************************************/
+uint32 Os_GetMissedTickCount(void)
+{
+    return g_Missed_Ticks;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetSkippedTickCount(void)
+{
+    return g_Skipped_Ticks;
+}
+
+/*********************************************************************************************/
+uint16 Os_GetTaskOverrunCount(Os_TaskType TaskId)
+{
+    return (TaskId < OS_CONFIGURED_TASKS) ? g_Task_Overrun_Count[TaskId] : 0;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTickCount(void)
+{
+    return g_Timer_Ticks;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTimeUs(void)
+{
+    uint32 ticks;
+    uint32 elapsed;
+    boolean expired;
+
+    /* Retry in case the tick interrupt updated the counter between the two reads */
+    do
+    {
+        ticks   = g_Timer_Ticks;
+        elapsed = SysTick_GetTimeElapsed();
+        expired = SysTick_IsInterruptPending();
+    } while(ticks != g_Timer_Ticks);
+
+    /* Called with the tick interrupt masked after the timer reloaded ... the tick is not counted yet */
+    if(expired == TRUE)
+    {
+        ticks++;
+        elapsed = SysTick_GetTimeElapsed();
+    }
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+    return (ticks * (OS_BASE_TIME * 1000U)) + (uint32)(((uint64)elapsed * g_Counts_To_Us_Scale) >> 16);
+}
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_TaskType task;
+#endif
+
+    /* Prepare the dispatch schedule before the first tick */
+    Os_BuildSchedule();
+
+#if (OS_ALARM_SERVICE == STD_ON)
+    Os_AlarmInit();
+#endif
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON) && !defined(OS_HOST_BUILD)
+    /* Enable the trace block then start the DWT cycle counter */
+    CORE_DEBUG_DEMCR_REG |= DWT_TRCENA_MASK;
+    DWT_CYCCNT_REG = 0;
+    DWT_CTRL_REG |= DWT_CYCCNTENA_MASK;
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* PendSV has the lowest priority so the context switch runs after all the interrupts are served */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & PENDSV_PRIORITY_MASK) | (PENDSV_INTERRUPT_PRIORITY << PENDSV_PRIORITY_BITS_POS);
+#endif
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
     
+#if (SYSTICK_OS_TICK_DIRECT_CALL == STD_OFF)
     /* 
-     * Set the Call Back function to call Os_NewTimerTick
+     * Add Os_NewTimerTick as a SysTick subscriber
      * this function will be called every SysTick Interrupt (20ms)
      */
-    SysTick_SetCallBack(Os_NewTimerTick);
+    (void)SysTick_AddSubscriber(Os_NewTimerTick, 1);
+#endif
 
     /* Start SysTickTimer to generate interrupt every 20ms */
     SysTick_Start(OS_BASE_TIME);
 
+    /* Microseconds per timer count = period in us / period in counts */
+    g_Counts_To_Us_Scale = (uint32)((((uint64)OS_BASE_TIME * 1000U) << 16)
+                                    / (SysTick_GetTimeElapsed() + SysTick_GetTimeRemaining() + 1));
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* Timer0A counts the same system clock as SysTick, convert the budgets once (the Init Task runs without budget) */
+    Timer0A_Init();
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        g_Budget_Counts[task] = (uint32)(((uint64)Os_Configuration.Tasks[task].Budget
+                                          * (SysTick_GetTimeElapsed() + SysTick_GetTimeRemaining() + 1))
+                                         / (OS_BASE_TIME * 1000U));
+    }
+#endif
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    /* SysTick counts the CPU clock so the timer period is also the tick period in cycles */
+    g_Tick_Cycles = SysTick_GetTimeElapsed() + SysTick_GetTimeRemaining() + 1;
+
+    /* Execute the Init Task */
+    g_Init_Task_Time = Os_ReadCycleCounter();
+    Init_Task();
+    g_Init_Task_Time = Os_ReadCycleCounter() - g_Init_Task_Time;
+#else
     /* Execute the Init Task */
     Init_Task();
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /*
+     * Switch to the highest priority ready context (the idle context runs the Os_Scheduler loop),
+     * the first PendSV saves this context on the idle stack and never returns here
+     */
+    Os_SetProcessStack(&g_Idle_Stack[OS_IDLE_STACK_SIZE / 4U]);
+    Disable_Exceptions();
+    g_Preemption_Started = TRUE;
+    Os_Dispatch();
+    Enable_Exceptions();
+
+    while(1)
+    {
 
+    }
+#else
     /* Start the Os Scheduler */
     Os_Scheduler();
+#endif
 }
 
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Release the tasks of the new tick directly, the PendSV switches to the highest priority ready task */
+    Disable_Exceptions();
+    g_Timer_Ticks++;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    g_Tick_Stamp = Os_ReadCycleCounter();
+#endif
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+    Os_RecordTickJitter();
+#endif
+    Os_ProcessTick(TRUE);
+    Os_Dispatch();
+    Enable_Exceptions();
+
+#if (OS_ALARM_SERVICE == STD_ON)
+    /* The alarm callbacks run after the critical section with the interrupts enabled */
+    Os_AlarmTick();
+#endif
+#else
+    /* The previous tick is still pending ... the scheduler is late */
+    if(g_Timer_Ticks != g_Processed_Ticks)
+    {
+        g_Missed_Ticks++;
+    }
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+    /* Count the new tick, the scheduler processes it in the thread mode */
+    g_Timer_Ticks++;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    /* Stamped after the count, Os_TickReleaseStamp retries if it reads between the two */
+    g_Tick_Stamp = Os_ReadCycleCounter();
+#endif
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+    Os_RecordTickJitter();
+#endif
+#endif
 }
 
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+    uint32 pending_ticks;
+
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
+        pending_ticks = g_Timer_Ticks - g_Processed_Ticks;
+
+        /* Code is only executed in case there are new timer ticks */
+        if(pending_ticks != 0)
+        {
+            /* Too many pending ticks ... drop the oldest ones to recover deterministically */
+            while(pending_ticks > OS_TICKS_TO_PROCESS)
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                Os_ProcessTick(FALSE);
+#if (OS_ALARM_SERVICE == STD_ON)
+                /* The alarms of the skipped ticks still expire (late) */
+                Os_AlarmTick();
+#endif
+                g_Skipped_Ticks++;
+                pending_ticks--;
             }
-	}
-    }
 
+            /* Process the pending ticks in order */
+            while(pending_ticks != 0)
+            {
+                Os_ProcessTick(TRUE);
+#if (OS_ALARM_SERVICE == STD_ON)
+                Os_AlarmTick();
+#endif
+                pending_ticks--;
+            }
+        }
+#if (OS_PREEMPTIVE == STD_OFF)
+        else if(g_Event_Set == TRUE)
+        {
+            /* The time-triggered releases go first, the activated tasks run once no tick is pending */
+            Os_DispatchEvents();
+        }
+#endif
+#if (OS_DEFERRED_WORK == STD_ON)
+        else if(Os_DeferredWorkReady() == TRUE)
+        {
+            /* One item at a time so a new tick or activation is served before the next item */
+            Os_RunDeferredWork();
+        }
+#endif
+#if (OS_IDLE_SLEEP == STD_ON)
+        else
+        {
+            /* Nothing to do until the next interrupt */
+            Os_IdleHook();
+        }
+#endif
+    }
 }
 /*********************************************************************************************/
@@ -12,24 +12,594 @@
 #ifndef OS_H_
 #define OS_H_
 
+/* Os Module Id */
+#define OS_MODULE_ID                        (1U)
+
+/* Os Instance Id */
+#define OS_INSTANCE_ID                      (0U)
+
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/*******************************************************************************
+ *                      Configuration Checks                                   *
+ *******************************************************************************/
+
+#if (OS_TICKLESS_IDLE == STD_ON) && (OS_IDLE_SLEEP == STD_OFF)
+  #error "OS_TICKLESS_IDLE needs OS_IDLE_SLEEP"
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON) && (OS_IDLE_SLEEP == STD_OFF)
+  #error "OS_CPU_LOAD_MONITOR needs OS_IDLE_SLEEP"
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON) && ((OS_CPU_LOAD_AVERAGE_SHIFT > 16U) || (OS_CPU_LOAD_LIMIT > 10000U))
+  #error "Invalid CPU load monitor configuration"
+#endif
+
+#if (OS_MISSED_TICK_POLICY != OS_TICK_CATCH_UP) && (OS_MISSED_TICK_POLICY != OS_TICK_SKIP)
+  #error "Invalid OS_MISSED_TICK_POLICY"
+#endif
+
+#if (OS_MAX_CATCH_UP_TICKS == 0U) || (OS_MAX_CATCH_UP_TICKS > 255U)
+  #error "OS_MAX_CATCH_UP_TICKS must be in the range 1 .. 255"
+#endif
+
+/* Alarm ids are uint16 and 0xFFFF marks an unused link */
+#if (OS_ALARM_SERVICE == STD_ON) && ((OS_ALARMS_NUM == 0U) || (OS_ALARMS_NUM > 0xFFFEU))
+  #error "OS_ALARMS_NUM must be in the range 1 .. 65534"
+#endif
+
+#if (OS_TIMING_HISTOGRAMS == STD_ON) && (OS_EXECUTION_TIME_STATS == STD_OFF)
+  #error "OS_TIMING_HISTOGRAMS needs OS_EXECUTION_TIME_STATS"
+#endif
+
+#if (OS_TIMING_HISTOGRAMS == STD_ON) && ((OS_HISTOGRAM_BUCKETS < 2U) || (OS_HISTOGRAM_BUCKETS > 33U))
+  #error "OS_HISTOGRAM_BUCKETS must be in the range 2 .. 33"
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* The ready tasks are kept in a 32-bit mask indexed by the priority */
+#if (OS_CONFIGURED_TASKS > 32U)
+  #error "The preemptive mode supports up to 32 tasks"
+#endif
+
+#if (OsConf_BUTTON_TASK_PRIORITY >= OS_CONFIGURED_TASKS) || (OsConf_APP_TASK_PRIORITY >= OS_CONFIGURED_TASKS) \
+ || (OsConf_LED_TASK_PRIORITY >= OS_CONFIGURED_TASKS)
+  #error "Task priorities must be less than OS_CONFIGURED_TASKS"
+#endif
+
+#if (OsConf_BUTTON_TASK_PRIORITY == OsConf_APP_TASK_PRIORITY) || (OsConf_BUTTON_TASK_PRIORITY == OsConf_LED_TASK_PRIORITY) \
+ || (OsConf_APP_TASK_PRIORITY == OsConf_LED_TASK_PRIORITY)
+  #error "Task priorities must be unique"
+#endif
+
+#if ((OS_TASK_STACK_SIZE % 8U) != 0U) || ((OS_IDLE_STACK_SIZE % 8U) != 0U)
+  #error "Stack sizes must be multiples of 8 bytes"
+#endif
+#endif
+
+#if (OS_DEFERRED_WORK == STD_ON) && ((OS_DEFERRED_WORK_QUEUE_LENGTH == 0U) || (OS_DEFERRED_WORK_QUEUE_LENGTH > 0x8000U) \
+ || ((OS_DEFERRED_WORK_QUEUE_LENGTH & (OS_DEFERRED_WORK_QUEUE_LENGTH - 1U)) != 0U) || (OS_DEFERRED_WORK_BUDGET >= (OS_BASE_TIME * 1000U)))
+  #error "Invalid deferred work configuration"
+#endif
+
+/* BASEPRI cannot mask the priority 0 (it marks a resource without interrupts) and the TM4C123 implements 3 priority bits */
+#if (OS_RESOURCES == STD_ON) && ((OsConf_TICK_RESOURCE_CEILING > 7U) || (OsConf_LED_RESOURCE_CEILING > 7U))
+  #error "Resource ceilings must be in the range 1 .. 7, or 0 for a resource shared by tasks only"
+#endif
+
+#if (OS_RESOURCES == STD_ON) && ((OsConf_TICK_RESOURCE_TASK_CEILING >= OS_CONFIGURED_TASKS) || (OsConf_LED_RESOURCE_TASK_CEILING >= OS_CONFIGURED_TASKS))
+  #error "Resource task ceilings must be task priorities"
+#endif
+
+/* A budget must leave room for the declared WCET and must stop the task before the next tick */
+#if (OS_TIMING_PROTECTION == STD_ON)
+#if ((OsConf_BUTTON_TASK_BUDGET != 0U) && ((OsConf_BUTTON_TASK_BUDGET < OsConf_BUTTON_TASK_WCET) || (OsConf_BUTTON_TASK_BUDGET >= (OS_BASE_TIME * 1000U)))) \
+ || ((OsConf_APP_TASK_BUDGET != 0U) && ((OsConf_APP_TASK_BUDGET < OsConf_APP_TASK_WCET) || (OsConf_APP_TASK_BUDGET >= (OS_BASE_TIME * 1000U)))) \
+ || ((OsConf_LED_TASK_BUDGET != 0U) && ((OsConf_LED_TASK_BUDGET < OsConf_LED_TASK_WCET) || (OsConf_LED_TASK_BUDGET >= (OS_BASE_TIME * 1000U))))
+  #error "Task budgets must be in the range WCET .. OS_BASE_TIME"
+#endif
+#endif
+
+/* The hyperperiod ticks index the schedule with uint8, the schedule entries are indexed with uint16 */
+#if ((OS_HYPERPERIOD % OS_BASE_TIME) != 0U) || (OS_HYPERPERIOD_TICKS > 255U)
+  #error "OS_HYPERPERIOD must be a multiple of OS_BASE_TIME and fit in 255 ticks"
+#endif
+
+#if (OS_SCHEDULE_ENTRIES > 65535U)
+  #error "Too many task releases in one hyperperiod"
+#endif
+
+/* Os_TaskType is uint8 and 0xFF marks no task */
+#if (OS_CONFIGURED_TASKS > 254U)
+  #error "OS_CONFIGURED_TASKS must not exceed 254"
+#endif
+
+#if defined(OS_HOST_BUILD) && ((OS_PREEMPTIVE == STD_ON) || (OS_IDLE_SLEEP == STD_OFF))
+  #error "The host build simulates the cooperative mode with OS_IDLE_SLEEP"
+#endif
+
+/* Every period must be a multiple of the base time and divide the hyperperiod (0 is an event task) */
+#if (OsConf_BUTTON_TASK_PERIOD != 0U) && (((OsConf_BUTTON_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_HYPERPERIOD % OsConf_BUTTON_TASK_PERIOD) != 0U))
+  #error "Invalid period for the Button Task"
+#endif
+
+#if (OsConf_APP_TASK_PERIOD != 0U) && (((OsConf_APP_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_HYPERPERIOD % OsConf_APP_TASK_PERIOD) != 0U))
+  #error "Invalid period for the App Task"
+#endif
+
+#if (OsConf_LED_TASK_PERIOD != 0U) && (((OsConf_LED_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_HYPERPERIOD % OsConf_LED_TASK_PERIOD) != 0U))
+  #error "Invalid period for the Led Task"
+#endif
+
+/* The periods of the low-power and diagnostic modes follow the same rules */
+#define OS_INVALID_PERIOD(PERIOD)           (((PERIOD) != 0U) && ((((PERIOD) % OS_BASE_TIME) != 0U) || ((OS_HYPERPERIOD % ((PERIOD) + ((PERIOD) == 0U))) != 0U)))
+
+#if OS_INVALID_PERIOD(OsConf_LOW_POWER_BUTTON_TASK_PERIOD) || OS_INVALID_PERIOD(OsConf_LOW_POWER_APP_TASK_PERIOD) \
+ || OS_INVALID_PERIOD(OsConf_LOW_POWER_LED_TASK_PERIOD) || OS_INVALID_PERIOD(OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD) \
+ || OS_INVALID_PERIOD(OsConf_DIAGNOSTIC_APP_TASK_PERIOD) || OS_INVALID_PERIOD(OsConf_DIAGNOSTIC_LED_TASK_PERIOD)
+  #error "Invalid task period in the low-power or diagnostic mode"
+#endif
+
+/* Every extra task is periodic with a period dividing the hyperperiod and an aligned offset inside it */
+#define OS_EXTRA_TASK_INVALID(NAME, PERIOD, OFFSET, PRIORITY, WCET) \
+    || ((PERIOD) == 0U) || OS_INVALID_PERIOD(PERIOD) || (((OFFSET) % OS_BASE_TIME) != 0U) || ((OFFSET) >= (PERIOD))
+
+#if (0 OS_EXTRA_TASKS(OS_EXTRA_TASK_INVALID))
+  #error "Invalid period or offset of an extra task"
+#endif
+
+#if (OS_CONFIGURED_APP_MODES == 0U) || (OS_DEFAULT_APP_MODE >= OS_CONFIGURED_APP_MODES)
+  #error "Invalid application mode configuration"
+#endif
+
+/* Shortest non-zero period of a task in all the modes, 0 for a task without periodic releases in any mode */
+#define OS_SHORTER_PERIOD(A, B)             (((A) == 0U) ? (B) : ((((B) == 0U) || ((A) < (B))) ? (A) : (B)))
+#define OS_TASK_MIN_PERIOD(NORMAL, LOW_POWER, DIAGNOSTIC) \
+                                            OS_SHORTER_PERIOD(OS_SHORTER_PERIOD(NORMAL, LOW_POWER), DIAGNOSTIC)
+
+/*
+ * The offset is shared by all the modes ... it must be aligned to the base time and lie below the shortest period of
+ * the task in all the modes (0 for an event task), Os_BuildSchedule would never release the task in a shorter period
+ */
+#define OS_INVALID_OFFSET(OFFSET, MIN_PERIOD) \
+                                            ((((OFFSET) % OS_BASE_TIME) != 0U) || (((OFFSET) != 0U) && ((OFFSET) >= (MIN_PERIOD))))
+
+#if OS_INVALID_OFFSET(OsConf_BUTTON_TASK_OFFSET, \
+                      OS_TASK_MIN_PERIOD(OsConf_BUTTON_TASK_PERIOD, OsConf_LOW_POWER_BUTTON_TASK_PERIOD, OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD))
+  #error "Invalid offset for the Button Task, it must be below its shortest period in all the modes"
+#endif
+
+#if OS_INVALID_OFFSET(OsConf_APP_TASK_OFFSET, \
+                      OS_TASK_MIN_PERIOD(OsConf_APP_TASK_PERIOD, OsConf_LOW_POWER_APP_TASK_PERIOD, OsConf_DIAGNOSTIC_APP_TASK_PERIOD))
+  #error "Invalid offset for the App Task, it must be below its shortest period in all the modes"
+#endif
+
+#if OS_INVALID_OFFSET(OsConf_LED_TASK_OFFSET, \
+                      OS_TASK_MIN_PERIOD(OsConf_LED_TASK_PERIOD, OsConf_LOW_POWER_LED_TASK_PERIOD, OsConf_DIAGNOSTIC_LED_TASK_PERIOD))
+  #error "Invalid offset for the Led Task, it must be below its shortest period in all the modes"
+#endif
+
+/*
+ * Schedulability checks using the declared WCETs ... they are sufficient tests,
+ * a task set passing them meets its deadlines (period or minimum interarrival time)
+ */
+#if (OsConf_BUTTON_TASK_MIN_INTERARRIVAL == 0U) || (OsConf_APP_TASK_MIN_INTERARRIVAL == 0U) || (OsConf_LED_TASK_MIN_INTERARRIVAL == 0U)
+  #error "Every task needs a minimum interarrival time"
+#endif
+
+/* The minimum interarrival time of a periodic task may not exceed its period in any mode */
+#define OS_INTERARRIVAL_ABOVE(INTERARRIVAL, PERIOD) (((PERIOD) != 0U) && ((INTERARRIVAL) > (PERIOD)))
+
+#if OS_INTERARRIVAL_ABOVE(OsConf_BUTTON_TASK_MIN_INTERARRIVAL, OsConf_BUTTON_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_BUTTON_TASK_MIN_INTERARRIVAL, OsConf_LOW_POWER_BUTTON_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_BUTTON_TASK_MIN_INTERARRIVAL, OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD)
+  #error "The minimum interarrival time of the Button Task must not exceed its periods"
+#endif
+
+#if OS_INTERARRIVAL_ABOVE(OsConf_APP_TASK_MIN_INTERARRIVAL, OsConf_APP_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_APP_TASK_MIN_INTERARRIVAL, OsConf_LOW_POWER_APP_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_APP_TASK_MIN_INTERARRIVAL, OsConf_DIAGNOSTIC_APP_TASK_PERIOD)
+  #error "The minimum interarrival time of the App Task must not exceed its periods"
+#endif
+
+#if OS_INTERARRIVAL_ABOVE(OsConf_LED_TASK_MIN_INTERARRIVAL, OsConf_LED_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_LED_TASK_MIN_INTERARRIVAL, OsConf_LOW_POWER_LED_TASK_PERIOD) \
+ || OS_INTERARRIVAL_ABOVE(OsConf_LED_TASK_MIN_INTERARRIVAL, OsConf_DIAGNOSTIC_LED_TASK_PERIOD)
+  #error "The minimum interarrival time of the Led Task must not exceed its periods"
+#endif
+
+#if (OS_UTILIZATION > OS_UTILIZATION_LIMIT)
+  #error "The task set utilization exceeds OS_UTILIZATION_LIMIT"
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Liu & Layland rate monotonic bound n * (2^(1/n) - 1) in ppm, valid when the shorter periods have the higher priorities */
+#if (OS_CONFIGURED_TASKS == 1U)
+#define OS_RM_UTILIZATION_BOUND             (1000000UL)
+#elif (OS_CONFIGURED_TASKS == 2U)
+#define OS_RM_UTILIZATION_BOUND             (828427UL)
+#elif (OS_CONFIGURED_TASKS == 3U)
+#define OS_RM_UTILIZATION_BOUND             (779763UL)
+#elif (OS_CONFIGURED_TASKS == 4U)
+#define OS_RM_UTILIZATION_BOUND             (756828UL)
+#elif (OS_CONFIGURED_TASKS == 5U)
+#define OS_RM_UTILIZATION_BOUND             (743491UL)
+#elif (OS_CONFIGURED_TASKS <= 8U)
+#define OS_RM_UTILIZATION_BOUND             (724061UL)    /* Bound of 8 tasks */
+#else
+#define OS_RM_UTILIZATION_BOUND             (693147UL)    /* Limit ln(2) */
+#endif
+
+#if (OS_UTILIZATION > OS_RM_UTILIZATION_BOUND)
+  #error "The task set fails the rate monotonic schedulability test"
+#endif
+#else
+/* The cooperative mode runs the tasks of one tick to completion, all of them must complete before the next tick */
+#if (OS_TASKS_WCET_SUM > (OS_BASE_TIME * 1000UL))
+  #error "The tasks released in one tick may not complete before the next tick"
+#endif
+#endif
+
+/*******************************************************************************
+ *                              API Service Id Macros                          *
+ *******************************************************************************/
+
+/* Service ID reported by the timing protection interrupt */
+#define OS_TIMING_PROTECTION_SID            (uint8)0x00
+
+/*******************************************************************************
+ *                              DET Error Codes                                *
+ *******************************************************************************/
+
+/* Runtime error reported when a task exceeds its execution budget */
+#define OS_E_PROTECTION_TIME                (uint8)0x01
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Os_TaskType used to index the task table */
+typedef uint8 Os_TaskType;
+
+/* Type definition for Os_AppModeType used to index the application mode table */
+typedef uint8 Os_AppModeType;
+
+/* Structure describing one task */
+typedef struct
+{
+    /* Task release offset in ms from the start of the hyperperiod */
+    uint16 Offset;
+    /* Task priority in the preemptive mode (the cooperative mode runs the tasks in the table order) */
+    uint8 Priority;
+    /* Execution budget in us enforced by the timing protection, 0 for no budget */
+    uint32 Budget;
+    /* Pointer to the task function */
+    void (*TaskFunc)(void);
+} Os_TaskConfigType;
+
+/* Structure describing one application mode */
+typedef struct
+{
+    /* Task periods in ms in the order of the task table, 0 for a task without periodic releases in this mode */
+    uint16 Periods[OS_CONFIGURED_TASKS];
+} Os_AppModeConfigType;
+
+#if (OS_ALARM_SERVICE == STD_ON)
+/* Type definition for Os_AlarmType used to identify an alarm (0 .. OS_ALARMS_NUM - 1) */
+typedef uint16 Os_AlarmType;
+
+/* Type definition for the function called when an alarm expires */
+typedef void (*Os_AlarmCallbackType)(void);
+#endif
+
+#if (OS_QUEUE_SERVICE == STD_ON)
+/*
+ * Single-producer single-consumer ring buffer: Head is written by the producer only and Tail by the consumer only
+ * so one ISR (or task) can send while one task (or ISR) receives without masking the interrupts.
+ * Head and Tail are free running, Head - Tail is the number of stored elements.
+ */
+typedef struct
+{
+    volatile uint16 Head;
+    volatile uint16 Tail;
+    uint16 Length;          /* Number of elements, power of two */
+    uint16 ElementSize;     /* Size of one element in bytes */
+    volatile uint8 * Buffer;
+} Os_QueueType;
+#endif
+
+#if (OS_DEFERRED_WORK == STD_ON)
+/* Type definition for a deferred work function, Context is the pointer given when the work was posted */
+typedef void (*Os_DeferredWorkFuncType)(void * Context);
+#endif
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/* Execution and response (release to completion) time statistics of a task in CPU cycles */
+typedef struct
+{
+    uint32 MinExecutionTime;
+    uint32 MaxExecutionTime;
+    uint32 AvgExecutionTime;
+    uint32 MinResponseTime;
+    uint32 MaxResponseTime;
+    uint32 AvgResponseTime;
+    uint32 Activations;     /* Number of completed runs since the last reset */
+} Os_TaskTimeStatsType;
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+/* CPU load in 0.01 % units (10000 is a fully loaded hyperperiod) */
+typedef struct
+{
+    uint16 Current;         /* Load of the last complete hyperperiod */
+    uint16 Peak;            /* Highest load since the last reset */
+    uint16 Average;         /* Moving average over about 2^OS_CPU_LOAD_AVERAGE_SHIFT hyperperiods */
+    uint32 Overloads;       /* Hyperperiods above OS_CPU_LOAD_LIMIT since the last reset */
+} Os_CpuLoadType;
+#endif
 
-/* Description: 
+#if (OS_TIMING_PROTECTION == STD_ON)
+/* Action returned by Os_ProtectionHook for a task that exceeded its budget */
+typedef uint8 Os_ProtectionActionType;
+#define OS_PRO_TERMINATE_TASK               ((Os_ProtectionActionType)0U)    /* Stop the task now, its locked resources are released */
+#define OS_PRO_IGNORE                       ((Os_ProtectionActionType)1U)    /* Let the task complete and skip its next release */
+#endif
+
+#if (OS_RESOURCES == STD_ON)
+/* Type definition for Os_ResourceType used to index the resource table */
+typedef uint8 Os_ResourceType;
+
+/* Structure describing one resource */
+typedef struct
+{
+    /* Highest NVIC priority of the interrupts using the resource (1 .. 7), 0 for a resource shared by tasks only */
+    uint8 Ceiling;
+    /* Highest priority of the tasks using the resource, the preemptive mode runs the holder at it */
+    uint8 TaskCeiling;
+} Os_ResourceConfigType;
+#endif
+
+/* Data Structure required for initializing the Os */
+typedef struct Os_ConfigType
+{
+    Os_TaskConfigType Tasks[OS_CONFIGURED_TASKS];
+    Os_AppModeConfigType AppModes[OS_CONFIGURED_APP_MODES];
+#if (OS_RESOURCES == STD_ON)
+    Os_ResourceConfigType Resources[OS_CONFIGURED_RESOURCES];
+#endif
+} Os_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description:
  * Function responsible for:
- * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 1. Build the dispatch schedules of all the application modes and select OS_DEFAULT_APP_MODE
+ * 2. Enable Interrupts
+ * 3. Start the Os timer
+ * 4. Execute the Init Task
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/*
+ * Description: The Engine of the Os Scheduler used for switch between different tasks,
+ *              in the preemptive mode it is the idle context and the tasks are switched by PendSV
+ */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/*
+ * Description: Activate a task from an interrupt or from another task, the scheduler runs it on the next dispatch.
+ *              Activations arriving before the task starts running are merged in one run.
+ *              Return E_NOT_OK for an invalid task id.
+ */
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId);
+
+/*
+ * Description: Switch to the dispatch schedule of another application mode from the next tick,
+ *              the time inside the hyperperiod is kept so the releases stay aligned.
+ *              Return E_NOT_OK for an invalid mode.
+ */
+Std_ReturnType Os_SetApplicationMode(Os_AppModeType Mode);
+
+/* Description: Return the application mode whose schedule is running */
+Os_AppModeType Os_GetActiveApplicationMode(void);
+
+/*
+ * Description: Enable the releases (periodic and Os_SetEvent) of a disabled task from the next tick,
+ *              return E_NOT_OK for an invalid task id
+ */
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId);
+
+/*
+ * Description: Disable the releases of a task from the next tick, a running release completes normally
+ *              and Os_SetEvent returns E_NOT_OK for the task once it is disabled.
+ *              Return E_NOT_OK for an invalid task id.
+ */
+Std_ReturnType Os_DisableTask(Os_TaskType TaskId);
+
+#if (OS_ALARM_SERVICE == STD_ON)
+/*
+ * Description: Start an alarm that calls Callback after Increment Os ticks then every Cycle ticks (0 for a one-shot alarm).
+ *              The callback runs in the scheduler (in the tick interrupt in the preemptive mode) so it must be short,
+ *              it may start or cancel alarms and activate tasks.
+ *              Return E_NOT_OK for an invalid alarm, an alarm already running, a zero Increment or a NULL callback.
+ *              Insertion and expiry take constant time whatever the number of running alarms.
+ */
+Std_ReturnType Os_SetRelAlarm(Os_AlarmType AlarmId, uint32 Increment, uint32 Cycle, Os_AlarmCallbackType Callback);
+
+/* Description: Stop a running alarm, return E_NOT_OK for an invalid alarm or an alarm that is not running */
+Std_ReturnType Os_CancelAlarm(Os_AlarmType AlarmId);
+#endif
+
+#if (OS_QUEUE_SERVICE == STD_ON)
+/*
+ * Description: Prepare an empty queue using Buffer of Length * ElementSize bytes.
+ *              Length must be a power of two up to 32768, return E_NOT_OK otherwise.
+ */
+Std_ReturnType Os_QueueInit(Os_QueueType * Queue, uint8 * Buffer, uint16 Length, uint16 ElementSize);
+
+/* Description: Copy one element to the queue (producer side), return E_NOT_OK if the queue is full */
+Std_ReturnType Os_QueueSend(Os_QueueType * Queue, const void * Data);
+
+/* Description: Copy the oldest element from the queue and remove it (consumer side), return E_NOT_OK if the queue is empty */
+Std_ReturnType Os_QueueReceive(Os_QueueType * Queue, void * Data);
+
+/* Description: Return the number of elements stored in the queue */
+uint16 Os_QueueCount(const Os_QueueType * Queue);
+#endif
+
+#if (OS_DEFERRED_WORK == STD_ON)
+/*
+ * Description: Queue Func(Context) to run in the idle time of the scheduler, after the tasks of the pending ticks
+ *              and the activated tasks, within OS_DEFERRED_WORK_BUDGET us per tick. Items run one at a time in the
+ *              posting order and must be short (an item is never interrupted by the budget).
+ *              It can be called from tasks and interrupts, return E_NOT_OK for a NULL function or a full queue.
+ */
+Std_ReturnType Os_PostDeferredWork(Os_DeferredWorkFuncType Func, void * Context);
+
+/* Description: Return the number of deferred work items rejected because the queue was full */
+uint32 Os_GetDeferredWorkDropCount(void);
+#endif
+
+#if (OS_RESOURCES == STD_ON)
+/*
+ * Description: Lock a resource with the immediate priority ceiling protocol. In the preemptive mode the calling task
+ *              runs at the task ceiling of the resource, so only the tasks of a higher priority preempt it.
+ *              A resource shared with interrupts also raises BASEPRI to its ceiling, masking the interrupts with the
+ *              same or lower priority (BASEPRI is never lowered here), a resource of tasks only leaves them enabled.
+ *              Resources are released in the reverse order, return E_NOT_OK for an invalid or already locked resource.
+ */
+Std_ReturnType Os_GetResource(Os_ResourceType ResId);
+
+/* Description: Unlock the last locked resource and restore the previous task ceiling and BASEPRI, return E_NOT_OK if ResId is not the last locked one */
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId);
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/*
+ * Description: Hook provided by the application and called from the timing protection interrupt (priority 0)
+ *              when a task exceeds its budget, after the violation is reported to the Det as a runtime error.
+ *              It must be short and must not call the Os services, it returns the action applied to the task.
+ */
+Os_ProtectionActionType Os_ProtectionHook(Os_TaskType TaskId);
+
+/* Description: Return how many times the task exceeded its execution budget */
+uint16 Os_GetBudgetViolationCount(Os_TaskType TaskId);
+
+/* Description: Timer0A interrupt handler of the timing protection, placed in the vector table */
+void Os_TimingProtectionHandler(void);
+#endif
+
+/* Description: Return the monotonic number of Os ticks since the Os started (wraps after 2^32 ticks) */
+uint32 Os_GetTickCount(void);
+
+/*
+ * Description: Return the monotonic Os time in microseconds (wraps after 2^32 us, about 71 minutes).
+ *              It combines the tick count with the current timer value so it costs a few cycles only,
+ *              and it can be called from tasks and interrupts (except the interrupts that wake the core
+ *              from a tickless sleep, the suppressed ticks are accounted after the wakeup).
+ */
+uint32 Os_GetTimeUs(void);
+
+/* Description: Return the number of ticks that arrived before the previous tick was completely processed */
+uint32 Os_GetMissedTickCount(void);
+
+/* Description: Return the number of ticks dropped by the missed tick policy without running their releases */
+uint32 Os_GetSkippedTickCount(void);
+
+/* Description: Return how many times the next tick arrived while the task was running */
+uint16 Os_GetTaskOverrunCount(Os_TaskType TaskId);
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/*
+ * Description: Fill Stats with the execution and response times of the task since the last reset,
+ *              return E_NOT_OK for an invalid task id or a NULL pointer
+ */
+Std_ReturnType Os_GetTaskTimeStats(Os_TaskType TaskId, Os_TaskTimeStatsType * Stats);
+
+/* Description: Clear the execution and response time statistics of all the tasks */
+void Os_ResetTaskTimeStats(void);
+
+/* Description: Return the execution time of the Init Task in CPU cycles */
+uint32 Os_GetInitTaskTime(void);
+#endif
+
+#if (OS_TIMING_HISTOGRAMS == STD_ON)
+/*
+ * Description: Copy to Histogram (OS_HISTOGRAM_BUCKETS elements) the histogram of the tick interrupt jitter,
+ *              the deviation in CPU cycles of every tick interrupt from the OS_BASE_TIME grid of the previous one
+ */
+void Os_GetTickJitterHistogram(uint32 * Histogram);
+
+/*
+ * Description: Copy to Histogram (OS_HISTOGRAM_BUCKETS elements) the histogram of the dispatch latency of the task,
+ *              the CPU cycles from its release (tick interrupt or activation) to its start.
+ *              Return E_NOT_OK for an invalid task id.
+ */
+Std_ReturnType Os_GetDispatchLatencyHistogram(Os_TaskType TaskId, uint32 * Histogram);
+
+/* Description: Clear all the histograms */
+void Os_ResetHistograms(void);
+#endif
+
+#if (OS_IDLE_SLEEP == STD_ON)
+/* Description: Return the time the core slept during the last complete hyperperiod in timer counts (CPU cycles) */
+uint32 Os_GetIdleTime(void);
+
+/* Description: Return the time the core was running during the last complete hyperperiod in timer counts (CPU cycles) */
+uint32 Os_GetBusyTime(void);
+#endif
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+/* Description: Fill Load with the current, peak and average CPU load updated at the start of every hyperperiod */
+void Os_GetCpuLoad(Os_CpuLoadType * Load);
+
+/* Description: Clear the peak CPU load and the overload count */
+void Os_ResetCpuLoadPeak(void);
+#endif
+
+#ifdef OS_HOST_BUILD
+/*******************************************************************************
+ *                      Host Build Interface                                   *
+ *******************************************************************************/
+
+/* Function running one release of a task, called by the host for every release of a tick, FALSE if it was dropped */
+typedef boolean (*Os_HostReleaseFuncType)(Os_TaskType Task);
+
+/* Function adding one release that ran from Start to End (simulated cycle counter) to the statistics of its task */
+typedef void (*Os_HostRecordFuncType)(Os_TaskType Task, uint32 Start, uint32 End);
+
+/* Description: Provided by the host build, simulated PRIMASK (Disable_Exceptions / Enable_Exceptions) */
+void Os_HostDisableInterrupts(void);
+void Os_HostEnableInterrupts(void);
+
+/* Description: Provided by the host build, simulated WFI ... the core sleeps until the next tick interrupt */
+void Os_HostWaitForInterrupt(void);
+
+/* Description: Provided by the host build, simulated DWT cycle counter of the calling thread */
+uint32 Os_HostCycleCounter(void);
+
+/*
+ * Description: Provided by the host build, run Release for the Count releases of a tick and return when all completed,
+ *              then call Record (if not NULL_PTR) for every release that ran, in schedule order, with its times on one core.
+ */
+void Os_HostRunReleases(const Os_TaskType * Tasks, uint16 Count, Os_HostReleaseFuncType Release, Os_HostRecordFuncType Record);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Os */
+extern const Os_ConfigType Os_Configuration;
+
 #endif /* OS_H_ */
@@ -0,0 +1,220 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Pre-compile option to sleep (WFI) between ticks instead of busy polling and to measure the idle time */
+#define OS_IDLE_SLEEP                       (STD_ON)
+
+/* Pre-compile option to suppress the timer interrupts of the ticks without releases while sleeping (needs OS_IDLE_SLEEP) */
+#define OS_TICKLESS_IDLE                    (STD_OFF)
+
+/* Pre-compile option to compute the CPU load of every hyperperiod from the idle time (needs OS_IDLE_SLEEP) */
+#define OS_CPU_LOAD_MONITOR                 (STD_ON)
+
+/* Moving average of the CPU load over about 2^n hyperperiods */
+#define OS_CPU_LOAD_AVERAGE_SHIFT           (3U)
+
+/* CPU load in 0.01 % above which a hyperperiod is counted as an overload */
+#define OS_CPU_LOAD_LIMIT                   (8000U)
+
+/* Pre-compile option for the preemptive fixed-priority mode (tasks run on their own stacks and are switched by PendSV) */
+#define OS_PREEMPTIVE                       (STD_OFF)
+
+/* Stack size in bytes of every task and of the idle context in the preemptive mode (multiple of 8) */
+#define OS_TASK_STACK_SIZE                  (512U)
+#define OS_IDLE_STACK_SIZE                  (256U)
+
+/* Pre-compile option for the alarm service (one-shot and cyclic callbacks counted in Os ticks) */
+#define OS_ALARM_SERVICE                    (STD_ON)
+
+/* Number of alarms that can run at the same time, memory is allocated statically for all of them */
+#define OS_ALARMS_NUM                       (32U)
+
+/* Pre-compile option for the single-producer single-consumer message queues */
+#define OS_QUEUE_SERVICE                    (STD_ON)
+
+/* Pre-compile option for the deferred work run by the scheduler in the idle time after the due tasks */
+#define OS_DEFERRED_WORK                    (STD_ON)
+
+/* Number of deferred work items that can wait at the same time (power of two) */
+#define OS_DEFERRED_WORK_QUEUE_LENGTH       (16U)
+
+/* Time in us the deferred work may use in one tick, an item is started only while some budget is left */
+#define OS_DEFERRED_WORK_BUDGET             (2000U)
+
+/* Pre-compile option to measure the execution and response time of every task with the DWT cycle counter */
+#define OS_EXECUTION_TIME_STATS             (STD_ON)
+
+/* Pre-compile option to record log2 histograms of the tick jitter and of the dispatch latency (needs OS_EXECUTION_TIME_STATS) */
+#define OS_TIMING_HISTOGRAMS                (STD_OFF)
+
+/* Number of histogram buckets ... bucket 0 counts 0 cycles, bucket n counts 2^(n-1) .. 2^n - 1 cycles, the last one also counts the larger values */
+#define OS_HISTOGRAM_BUCKETS                (24U)
+
+/* Pre-compile option for the resources locked with the priority ceiling protocol (BASEPRI) */
+#define OS_RESOURCES                        (STD_ON)
+
+/* Pre-compile option to stop the tasks running longer than their execution budget (Timer0A interrupt) */
+#define OS_TIMING_PROTECTION                (STD_ON)
+
+/* Missed tick policies */
+#define OS_TICK_CATCH_UP                    (0U)   /* Run the releases of the missed ticks (up to OS_MAX_CATCH_UP_TICKS) */
+#define OS_TICK_SKIP                        (1U)   /* Drop the missed ticks and run the releases of the latest tick only */
+
+/* Policy used when the tick processing overruns and ticks are pending */
+#define OS_MISSED_TICK_POLICY               (OS_TICK_CATCH_UP)
+
+/* Maximum number of pending ticks processed with the catch-up policy, the older ones are skipped */
+#define OS_MAX_CATCH_UP_TICKS               (3U)
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                        (20U)
+
+/*
+ * Extra periodic tasks appended to the task table after the Led Task ... X(NAME, PERIOD, OFFSET, PRIORITY, WCET) for every one,
+ * NAME##_Task is released with the same period in all the modes. None on target, the host simulator adds a large task set
+ */
+#if defined(OS_HOST_BUILD) && defined(OS_HOST_LARGE_TASK_SET)
+#include "Os_HostTaskSet.h"
+#else
+#define OS_EXTRA_TASKS(X)
+#endif
+
+/* Number of the configured tasks (periodic and event tasks) */
+#define OS_EXTRA_TASK_COUNT(NAME, PERIOD, OFFSET, PRIORITY, WCET)          + 1U
+#define OS_CONFIGURED_TASKS                 (3U OS_EXTRA_TASKS(OS_EXTRA_TASK_COUNT))
+
+/* Task Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_TASK_ID_INDEX         (uint8)0x00
+#define OsConf_APP_TASK_ID_INDEX            (uint8)0x01
+#define OsConf_LED_TASK_ID_INDEX            (uint8)0x02
+
+/* Number of the application modes, every mode has its own dispatch schedule */
+#define OS_CONFIGURED_APP_MODES             (3U)
+
+/* Application mode Index in the array of structures in Os_PBcfg.c */
+#define OsConf_NORMAL_APP_MODE              (0U)
+#define OsConf_LOW_POWER_APP_MODE           (1U)
+#define OsConf_DIAGNOSTIC_APP_MODE          (2U)
+
+/* Application mode selected by Os_start */
+#define OS_DEFAULT_APP_MODE                 (OsConf_NORMAL_APP_MODE)
+
+/* Task periods in ms in the normal mode ... must be multiples of OS_BASE_TIME, 0 for a task activated by Os_SetEvent only */
+#define OsConf_BUTTON_TASK_PERIOD           (20U)
+#define OsConf_APP_TASK_PERIOD              (0U)
+#define OsConf_LED_TASK_PERIOD              (40U)
+
+/* Task periods in ms in the low-power mode ... the Led Task is shed and the button is sampled at half rate */
+#define OsConf_LOW_POWER_BUTTON_TASK_PERIOD (40U)
+#define OsConf_LOW_POWER_APP_TASK_PERIOD    (0U)
+#define OsConf_LOW_POWER_LED_TASK_PERIOD    (0U)
+
+/* Task periods in ms in the diagnostic mode ... the led is refreshed every tick */
+#define OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD (20U)
+#define OsConf_DIAGNOSTIC_APP_TASK_PERIOD   (0U)
+#define OsConf_DIAGNOSTIC_LED_TASK_PERIOD   (20U)
+
+/* Task priorities used by the preemptive mode ... unique values, higher value preempts lower value */
+#define OsConf_BUTTON_TASK_PRIORITY         (2U)
+#define OsConf_APP_TASK_PRIORITY            (0U)
+#define OsConf_LED_TASK_PRIORITY            (1U)
+
+/* Declared worst case execution times in us ... update them from Os_GetTaskTimeStats, used by Tools/Os_OffsetOptimizer.c */
+#define OsConf_BUTTON_TASK_WCET             (40U)
+#define OsConf_APP_TASK_WCET                (20U)
+#define OsConf_LED_TASK_WCET                (20U)
+
+/* Execution budgets in us enforced by the timing protection ... 0 for a task without budget */
+#define OsConf_BUTTON_TASK_BUDGET           (1000U)
+#define OsConf_APP_TASK_BUDGET              (1000U)
+#define OsConf_LED_TASK_BUDGET              (1000U)
+
+/* Minimum time in ms between two releases used by the schedulability checks (the shortest period of a periodic task in all the modes) */
+#define OsConf_BUTTON_TASK_MIN_INTERARRIVAL (OsConf_BUTTON_TASK_PERIOD)
+#define OsConf_APP_TASK_MIN_INTERARRIVAL    (OsConf_BUTTON_TASK_PERIOD)    /* Activated by the button edge interrupt, masked for more than a Button Task period after every change */
+#define OsConf_LED_TASK_MIN_INTERARRIVAL    (OsConf_DIAGNOSTIC_LED_TASK_PERIOD)
+
+/* Upper bound of the task set utilization accepted at build time in ppm (1000000 is a fully loaded CPU) */
+#define OS_UTILIZATION_LIMIT                (700000UL)
+
+/*
+ * Task release offsets in ms shared by all the modes ... must be multiples of OS_BASE_TIME and less than the shortest period
+ * of the task in all the modes (0 for event tasks),
+ * Tools/Os_OffsetOptimizer.c prints the offsets that minimize the peak load of one tick
+ */
+#define OsConf_BUTTON_TASK_OFFSET           (0U)
+#define OsConf_APP_TASK_OFFSET              (0U)
+#define OsConf_LED_TASK_OFFSET              (0U)
+
+/* Number of the configured resources */
+#define OS_CONFIGURED_RESOURCES             (2U)
+
+/* Resource Index in the array of structures in Os_PBcfg.c */
+#define OsConf_TICK_RESOURCE_ID_INDEX       (uint8)0x00
+#define OsConf_LED_RESOURCE_ID_INDEX        (uint8)0x01
+
+/*
+ * Resource ceilings ... highest NVIC priority (1 .. 7, lower value is higher priority) of the interrupts using the resource,
+ * 0 for a resource shared by tasks only (BASEPRI is not raised).
+ * The tick resource protects the data shared with the SysTick interrupt (priority 3) and the alarm callbacks,
+ * the led resource protects the led state shared by the App and Led Tasks
+ */
+#define OsConf_TICK_RESOURCE_CEILING        (3U)
+#define OsConf_LED_RESOURCE_CEILING         (0U)
+
+/*
+ * Resource task ceilings ... highest priority of the tasks using the resource, in the preemptive mode the task holding
+ * the resource runs at it so only the tasks with a higher priority preempt it
+ */
+#define OsConf_TICK_RESOURCE_TASK_CEILING   (OsConf_BUTTON_TASK_PRIORITY)
+#define OsConf_LED_RESOURCE_TASK_CEILING    (OsConf_LED_TASK_PRIORITY)
+
+/* Hyperperiod in ms ... least common multiple of all the periodic task periods of all the modes */
+#define OS_HYPERPERIOD                      (40U)
+
+/* Number of Os ticks in one hyperperiod */
+#define OS_HYPERPERIOD_TICKS                (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* Number of releases of a task in one hyperperiod (event tasks have no periodic releases) */
+#define OS_TASK_RELEASES(PERIOD)            (((PERIOD) == 0U) ? 0U : (OS_HYPERPERIOD / (PERIOD)))
+
+/* Number of task releases in one hyperperiod of a mode */
+#define OS_MODE_SCHEDULE_ENTRIES(BUTTON_PERIOD, APP_PERIOD, LED_PERIOD) \
+                                            (OS_TASK_RELEASES(BUTTON_PERIOD) + OS_TASK_RELEASES(APP_PERIOD) + OS_TASK_RELEASES(LED_PERIOD))
+
+/* Number of releases of an extra task in the hyperperiods of all the modes */
+#define OS_EXTRA_TASK_RELEASES(NAME, PERIOD, OFFSET, PRIORITY, WCET)       + (OS_CONFIGURED_APP_MODES * OS_TASK_RELEASES(PERIOD))
+
+/* Number of task releases in the dispatch schedules of all the modes */
+#define OS_SCHEDULE_ENTRIES                 (OS_MODE_SCHEDULE_ENTRIES(OsConf_BUTTON_TASK_PERIOD, OsConf_APP_TASK_PERIOD, OsConf_LED_TASK_PERIOD)                                  \
+                                           + OS_MODE_SCHEDULE_ENTRIES(OsConf_LOW_POWER_BUTTON_TASK_PERIOD, OsConf_LOW_POWER_APP_TASK_PERIOD, OsConf_LOW_POWER_LED_TASK_PERIOD)     \
+                                           + OS_MODE_SCHEDULE_ENTRIES(OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD, OsConf_DIAGNOSTIC_APP_TASK_PERIOD, OsConf_DIAGNOSTIC_LED_TASK_PERIOD)  \
+                                           OS_EXTRA_TASKS(OS_EXTRA_TASK_RELEASES))
+
+/* Utilization of a task in ppm ... WCET in us over the minimum interarrival time in ms */
+#define OS_TASK_UTILIZATION(WCET, INTERARRIVAL) (((WCET) * 1000UL) / (INTERARRIVAL))
+
+/* Utilization of the task set in ppm */
+#define OS_EXTRA_TASK_UTILIZATION(NAME, PERIOD, OFFSET, PRIORITY, WCET)    + OS_TASK_UTILIZATION(WCET, PERIOD)
+#define OS_UTILIZATION                      (OS_TASK_UTILIZATION(OsConf_BUTTON_TASK_WCET, OsConf_BUTTON_TASK_MIN_INTERARRIVAL) \
+                                           + OS_TASK_UTILIZATION(OsConf_APP_TASK_WCET,    OsConf_APP_TASK_MIN_INTERARRIVAL)    \
+                                           + OS_TASK_UTILIZATION(OsConf_LED_TASK_WCET,    OsConf_LED_TASK_MIN_INTERARRIVAL)    \
+                                           OS_EXTRA_TASKS(OS_EXTRA_TASK_UTILIZATION))
+
+/* Sum of the WCETs in us ... the worst case load of one tick when all the tasks are released together */
+#define OS_EXTRA_TASK_WCET(NAME, PERIOD, OFFSET, PRIORITY, WCET)           + (WCET)
+#define OS_TASKS_WCET_SUM                   (OsConf_BUTTON_TASK_WCET + OsConf_APP_TASK_WCET + OsConf_LED_TASK_WCET \
+                                           OS_EXTRA_TASKS(OS_EXTRA_TASK_WCET))
+
+#endif /* OS_CFG_H_ */
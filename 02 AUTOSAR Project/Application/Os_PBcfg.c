@@ -0,0 +1,44 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Os Scheduler.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Extra tasks of Os_Cfg.h, they have no execution budget */
+#define OS_EXTRA_TASK_DECLARATION(NAME, PERIOD, OFFSET, PRIORITY, WCET)    void NAME##_Task(void);
+#define OS_EXTRA_TASK_CONFIG(NAME, PERIOD, OFFSET, PRIORITY, WCET)         , {(OFFSET), (PRIORITY), 0U, NAME##_Task}
+#define OS_EXTRA_TASK_PERIOD(NAME, PERIOD, OFFSET, PRIORITY, WCET)         , (PERIOD)
+
+OS_EXTRA_TASKS(OS_EXTRA_TASK_DECLARATION)
+
+/* PB structure used by Os_start to build the dispatch schedules
+ * The order of the tasks is the order they are dispatched in the same tick */
+const Os_ConfigType Os_Configuration = {
+                                           {
+                                               {OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_PRIORITY, OsConf_BUTTON_TASK_BUDGET, Button_Task},
+                                               {OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_PRIORITY,    OsConf_APP_TASK_BUDGET,    App_Task},
+                                               {OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_PRIORITY,    OsConf_LED_TASK_BUDGET,    Led_Task}
+                                               OS_EXTRA_TASKS(OS_EXTRA_TASK_CONFIG)
+                                           },
+                                           {
+                                               /* Task periods of every mode in the order of the task table */
+                                               {{OsConf_BUTTON_TASK_PERIOD,            OsConf_APP_TASK_PERIOD,            OsConf_LED_TASK_PERIOD OS_EXTRA_TASKS(OS_EXTRA_TASK_PERIOD)}},
+                                               {{OsConf_LOW_POWER_BUTTON_TASK_PERIOD,  OsConf_LOW_POWER_APP_TASK_PERIOD,  OsConf_LOW_POWER_LED_TASK_PERIOD OS_EXTRA_TASKS(OS_EXTRA_TASK_PERIOD)}},
+                                               {{OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD, OsConf_DIAGNOSTIC_APP_TASK_PERIOD, OsConf_DIAGNOSTIC_LED_TASK_PERIOD OS_EXTRA_TASKS(OS_EXTRA_TASK_PERIOD)}}
+                                           }
+#if (OS_RESOURCES == STD_ON)
+                                           ,
+                                           {
+                                               {OsConf_TICK_RESOURCE_CEILING, OsConf_TICK_RESOURCE_TASK_CEILING},
+                                               {OsConf_LED_RESOURCE_CEILING,  OsConf_LED_RESOURCE_TASK_CEILING}
+                                           }
+#endif
+                                       };
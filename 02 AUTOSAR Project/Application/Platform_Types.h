@@ -72,8 +72,14 @@ typedef unsigned char         uint8;          /*           0 .. 255
 typedef signed char           sint8;          /*        -128 .. +127            */
 typedef unsigned short        uint16;         /*           0 .. 65535           */
 typedef signed short          sint16;         /*      -32768 .. +32767          */
+#ifdef OS_HOST_BUILD
+/* The host simulator runs on LP64 hosts where long is 64-bit */
+typedef unsigned int          uint32;         /*           0 .. 4294967295      */
+typedef signed int            sint32;         /* -2147483648 .. +2147483647     */
+#else
 typedef unsigned long         uint32;         /*           0 .. 4294967295      */
 typedef signed long           sint32;         /* -2147483648 .. +2147483647     */
+#endif
 typedef unsigned long long    uint64;         /*       0..18446744073709551615  */
 typedef signed long long      sint64;         /* -9223372036854775808 .. 9223372036854775807 */
 typedef float                 float32;
@@ -10,9 +10,13 @@
  ******************************************************************************/
 
 #include "Os.h"
+#include "Mcu.h"
 
 int main(void)
 {
+    /* Switch to the configured system clock before the Os computes its timebase from it */
+    Mcu_InitClock();
+
     /* Start the Os */
     Os_start();
 }
@@ -1,7 +1,7 @@
 #ifndef TM4C123GH6PM_REGISTERS
 #define TM4C123GH6PM_REGISTERS
 
-#include "std_types.h"
+#include "Std_Types.h"
 
 /*****************************************************************************
 GPIO registers (PORTA)
@@ -191,6 +191,7 @@ NVIC Registers
 #define NVIC_DIS2_REG             (*((volatile uint32 *)0xE000E188))
 #define NVIC_DIS3_REG             (*((volatile uint32 *)0xE000E18C))
 #define NVIC_DIS4_REG             (*((volatile uint32 *)0xE000E190))
+#define NVIC_UNPEND0_REG          (*((volatile uint32 *)0xE000E280))
 
 /*****************************************************************************
 System Control Block Registers
@@ -202,6 +203,13 @@ System Control Block Registers
 #define NVIC_SYSTEM_INTCTRL       (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_CFGCTRL       (*((volatile uint32 *)0xE000ED14))
 
+/*****************************************************************************
+Debug and Data Watchpoint and Trace (DWT) Registers
+*****************************************************************************/
+#define CORE_DEBUG_DEMCR_REG      (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 /*****************************************************************************
 MPU Registers
 *****************************************************************************/
@@ -23,6 +23,8 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include "Std_Types.h"
+#include "Os_Cfg.h"
 
 //*****************************************************************************
 //
@@ -34,6 +36,24 @@ static void NmiSR(void);
 static void FaultISR(void);
 static void IntDefaultHandler(void);
 extern void SysTick_Handler(void);
+#if (OS_PREEMPTIVE == STD_ON)
+extern void PendSV_Handler(void);
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+extern void Os_TimingProtectionHandler(void);
+#endif
+extern void Button_PortF_Isr(void);
+extern void Gpt_Timer1A_Isr(void);
+extern void Gpt_Timer2A_Isr(void);
+extern void Gpt_Timer3A_Isr(void);
+extern void Gpt_Timer4A_Isr(void);
+extern void Gpt_Timer5A_Isr(void);
+extern void Gpt_WideTimer0A_Isr(void);
+extern void Gpt_WideTimer1A_Isr(void);
+extern void Gpt_WideTimer2A_Isr(void);
+extern void Gpt_WideTimer3A_Isr(void);
+extern void Gpt_WideTimer4A_Isr(void);
+extern void Gpt_WideTimer5A_Isr(void);
 
 //*****************************************************************************
 //
@@ -82,7 +102,11 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
+#if (OS_PREEMPTIVE == STD_ON)
+    PendSV_Handler,                         // The PendSV handler
+#else
     IntDefaultHandler,                      // The PendSV handler
+#endif
     SysTick_Handler,                        // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
@@ -103,23 +127,27 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // ADC Sequence 2
     IntDefaultHandler,                      // ADC Sequence 3
     IntDefaultHandler,                      // Watchdog timer
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_TimingProtectionHandler,             // Timer 0 subtimer A
+#else
     IntDefaultHandler,                      // Timer 0 subtimer A
+#endif
     IntDefaultHandler,                      // Timer 0 subtimer B
-    IntDefaultHandler,                      // Timer 1 subtimer A
+    Gpt_Timer1A_Isr,                        // Timer 1 subtimer A
     IntDefaultHandler,                      // Timer 1 subtimer B
-    IntDefaultHandler,                      // Timer 2 subtimer A
+    Gpt_Timer2A_Isr,                        // Timer 2 subtimer A
     IntDefaultHandler,                      // Timer 2 subtimer B
     IntDefaultHandler,                      // Analog Comparator 0
     IntDefaultHandler,                      // Analog Comparator 1
     IntDefaultHandler,                      // Analog Comparator 2
     IntDefaultHandler,                      // System Control (PLL, OSC, BO)
     IntDefaultHandler,                      // FLASH Control
-    IntDefaultHandler,                      // GPIO Port F
+    Button_PortF_Isr,                       // GPIO Port F
     IntDefaultHandler,                      // GPIO Port G
     IntDefaultHandler,                      // GPIO Port H
     IntDefaultHandler,                      // UART2 Rx and Tx
     IntDefaultHandler,                      // SSI1 Rx and Tx
-    IntDefaultHandler,                      // Timer 3 subtimer A
+    Gpt_Timer3A_Isr,                        // Timer 3 subtimer A
     IntDefaultHandler,                      // Timer 3 subtimer B
     IntDefaultHandler,                      // I2C1 Master and Slave
     IntDefaultHandler,                      // Quadrature Encoder 1
@@ -154,7 +182,7 @@ void (* const g_pfnVectors[])(void) =
     0,                                      // Reserved
     IntDefaultHandler,                      // I2C2 Master and Slave
     IntDefaultHandler,                      // I2C3 Master and Slave
-    IntDefaultHandler,                      // Timer 4 subtimer A
+    Gpt_Timer4A_Isr,                        // Timer 4 subtimer A
     IntDefaultHandler,                      // Timer 4 subtimer B
     0,                                      // Reserved
     0,                                      // Reserved
@@ -176,19 +204,19 @@ void (* const g_pfnVectors[])(void) =
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
-    IntDefaultHandler,                      // Timer 5 subtimer A
+    Gpt_Timer5A_Isr,                        // Timer 5 subtimer A
     IntDefaultHandler,                      // Timer 5 subtimer B
-    IntDefaultHandler,                      // Wide Timer 0 subtimer A
+    Gpt_WideTimer0A_Isr,                    // Wide Timer 0 subtimer A
     IntDefaultHandler,                      // Wide Timer 0 subtimer B
-    IntDefaultHandler,                      // Wide Timer 1 subtimer A
+    Gpt_WideTimer1A_Isr,                    // Wide Timer 1 subtimer A
     IntDefaultHandler,                      // Wide Timer 1 subtimer B
-    IntDefaultHandler,                      // Wide Timer 2 subtimer A
+    Gpt_WideTimer2A_Isr,                    // Wide Timer 2 subtimer A
     IntDefaultHandler,                      // Wide Timer 2 subtimer B
-    IntDefaultHandler,                      // Wide Timer 3 subtimer A
+    Gpt_WideTimer3A_Isr,                    // Wide Timer 3 subtimer A
     IntDefaultHandler,                      // Wide Timer 3 subtimer B
-    IntDefaultHandler,                      // Wide Timer 4 subtimer A
+    Gpt_WideTimer4A_Isr,                    // Wide Timer 4 subtimer A
     IntDefaultHandler,                      // Wide Timer 4 subtimer B
-    IntDefaultHandler,                      // Wide Timer 5 subtimer A
+    Gpt_WideTimer5A_Isr,                    // Wide Timer 5 subtimer A
     IntDefaultHandler,                      // Wide Timer 5 subtimer B
     IntDefaultHandler,                      // FPU
     0,                                      // Reserved
@@ -0,0 +1,92 @@
+ /******************************************************************************
+ *
+ * Module: Application
+ *
+ * File Name: App_Host.c
+ *
+ * Description: Host models of the Application Tasks used by the host simulator instead of App.c.
+ *              Every task spends 50 % to 100 % of its declared WCET (Os_Cfg.h) of simulated CPU time,
+ *              the button is pressed and released every HOST_BUTTON_HOLD_TICKS ticks.
+ *              The load tasks of the large task set (Os_HostTaskSet.h) are modelled the same way.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#include "App.h"
+#include "Os.h"
+#include "Os_Host.h"
+
+/* Os ticks between two changes of the simulated button */
+#define HOST_BUTTON_HOLD_TICKS              (50U)
+
+/*********************************************************************************************/
+/* Description: Spend a pseudo-random part (50 % .. 100 %) of a WCET in us, Seed is owned by the calling task */
+static void App_HostRun(uint32 Wcet, uint32 * Seed)
+{
+    uint32 cycles = Wcet * OS_HOST_CYCLES_PER_US;
+
+    /* Numerical Recipes LCG ... deterministic for a given release order */
+    *Seed = (*Seed * 1664525U) + 1013904223U;
+    Os_HostConsume((cycles / 2U) + (uint32)(((uint64)(*Seed >> 8) * (cycles / 2U)) >> 24));
+}
+
+/* Description: Task executes once to initialize all the Modules */
+void Init_Task(void)
+{
+    /* Mcu, Port and Dio init ... about 100 us */
+    Os_HostConsume(100U * OS_HOST_CYCLES_PER_US);
+}
+
+/* Description: Task executes every 20 Mili-seconds to check the button state and activate the App Task on a change */
+void Button_Task(void)
+{
+    static uint32 seed = 1U;
+    static boolean button_previous_state = FALSE;
+    boolean button_state = ((Os_GetTickCount() / HOST_BUTTON_HOLD_TICKS) & 1U) ? TRUE : FALSE;
+
+    App_HostRun(OsConf_BUTTON_TASK_WCET, &seed);
+
+    if(button_state != button_previous_state)
+    {
+        (void)Os_SetEvent(OsConf_APP_TASK_ID_INDEX);
+    }
+    button_previous_state = button_state;
+}
+
+/* Description: Task executes every 40 Mili-seconds to refresh the LED */
+void Led_Task(void)
+{
+    static uint32 seed = 2U;
+
+    App_HostRun(OsConf_LED_TASK_WCET, &seed);
+}
+
+/* Description: Task activated by the Button Task when the button state changes to get the button status and toggle the led */
+void App_Task(void)
+{
+    static uint32 seed = 3U;
+
+    App_HostRun(OsConf_APP_TASK_WCET, &seed);
+}
+
+/* Description: Load tasks of the large task set, every one owns its seed */
+#define HOST_LOAD_TASK(NAME, PERIOD, OFFSET, PRIORITY, WCET) \
+void NAME##_Task(void)                                        \
+{                                                             \
+    static uint32 seed = (PRIORITY);                          \
+                                                              \
+    App_HostRun((WCET), &seed);                               \
+}
+
+OS_EXTRA_TASKS(HOST_LOAD_TASK)
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/* Description: Called when a task exceeds its execution budget ... not called on the host, the budgets are not enforced */
+Os_ProtectionActionType Os_ProtectionHook(Os_TaskType TaskId)
+{
+    /* Same action for every task, the Os already reported the violation to the Det */
+    (void)TaskId;
+
+    return OS_PRO_TERMINATE_TASK;
+}
+#endif
@@ -0,0 +1,632 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Host.c
+ *
+ * Description: Source file of the host simulator running the Os scheduler on a Linux PC.
+ *
+ *              Virtual core ... the simulated time advances only when a task model calls Os_HostConsume
+ *              or when the scheduler sleeps (WFI jumps to the next SysTick expiry), so a week of Os ticks
+ *              runs in seconds. The SysTick interrupt is served on the scheduler thread at the first point
+ *              the interrupts are enabled after the expiry, like a masked interrupt staying pending on target.
+ *
+ *              Work-stealing pool ... the releases of a tick (same g_Schedule_Tasks table as on target) are
+ *              split in one contiguous shard per worker. The owner takes from the front of its shard, an idle
+ *              worker steals half of the remaining releases from the back of another shard. A shard is one
+ *              64-bit word (begin, end) changed by CAS only, so owner and thieves never take the same release.
+ *              Every release is measured on the clock of its worker, then the scheduler thread walks the tick
+ *              in schedule order: a release starts at the tick plus the cycles of the releases before it
+ *              (prefix sum), as on the one target core, and its times are recorded at that place. A task reading
+ *              the clock while it runs (e.g. the activation stamp of Os_SetEvent) waits for the releases before
+ *              it to complete and gets the same prefix sum. The execution and response times are therefore the
+ *              same as with one worker, whatever thread ran the release.
+ *
+ *              Build and run from this folder (cooperative mode with OS_IDLE_SLEEP only):
+ *                  gcc -std=c11 -O2 -pthread -DOS_HOST_BUILD -I. -I../Application Os_Host.c Os_HostMain.c App_Host.c \
+ *                      ../Application/Os.c ../Application/Os_PBcfg.c ../Application/Det.c -o Os_Host
+ *                  ./Os_Host [ticks] [workers] [verify]
+ *
+ *              The three application tasks release at most 3 tasks per tick, below OS_HOST_MIN_PARALLEL_RELEASES,
+ *              so the pool only runs with the large task set of Os_HostTaskSet.h (add -DOS_HOST_LARGE_TASK_SET),
+ *              or with a lower threshold (e.g. -DOS_HOST_MIN_PARALLEL_RELEASES=2U). The verify argument
+ *              checks that the sharded run gives every task the same releases and the same execution and response
+ *              times as a run with one worker. More workers than online CPUs run the releases serially.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Os_Host.h"
+#include "Os.h"
+#include "Gpt.h"
+
+#if !defined(OS_HOST_BUILD)
+  #error "Os_Host.c is compiled with OS_HOST_BUILD only"
+#endif
+
+/* One shard of the releases of a tick ... begin in the high half, end in the low half, on its own cache line */
+typedef struct
+{
+    _Alignas(64) _Atomic uint64 Range;
+} Os_HostShardType;
+
+#define OS_HOST_RANGE(BEGIN, END)           (((uint64)(BEGIN) << 32) | (uint64)(END))
+#define OS_HOST_RANGE_BEGIN(RANGE)          ((uint32)((RANGE) >> 32))
+#define OS_HOST_RANGE_END(RANGE)            ((uint32)(RANGE))
+
+/* Simulated PRIMASK ... owned by one thread at a time, CPSID / CPSIE do not nest */
+static pthread_mutex_t g_Interrupt_Mask = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local boolean g_Mask_Owned = FALSE;
+
+/* Virtual time in cycles of the scheduler thread, and of the calling thread while it runs releases of the pool */
+static uint64 g_Virtual_Clock = 0;
+static _Thread_local boolean g_In_Batch = FALSE;
+static _Thread_local uint64 g_Thread_Clock = 0;
+
+/* Index in the tick of the release run by the calling thread and its own clock at the start of the release */
+static _Thread_local uint32 g_Release_Index = 0;
+static _Thread_local uint64 g_Release_Begin = 0;
+
+/* Simulated SysTick Timer */
+static uint32 g_SysTick_Reload = 0;
+static uint64 g_SysTick_Expiry = 0;
+static boolean g_SysTick_Running = FALSE;
+
+/* Simulated SysTick subscribers, same table as the target driver */
+static struct
+{
+    void (*Callback)(void);
+    uint16 Divisor;
+    uint16 Countdown;
+} g_SysTick_Subscribers[SYSTICK_MAX_SUBSCRIBERS];
+
+/* Served ticks and the tick ending the simulation */
+static uint64 g_Served_Ticks = 0;
+static uint64 g_Tick_Limit = 0;
+
+/* Worker pool */
+static uint8 g_Workers = 1;
+static Os_HostShardType g_Shards[OS_HOST_MAX_WORKERS];
+static pthread_t g_Threads[OS_HOST_MAX_WORKERS];
+static pthread_mutex_t g_Pool_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_Pool_Start = PTHREAD_COND_INITIALIZER;
+static uint32 g_Batch_Generation = 0;
+
+/* Releases of the current tick shared with the workers */
+static const Os_TaskType * g_Batch_Tasks = NULL_PTR;
+static Os_HostReleaseFuncType g_Batch_Release = NULL_PTR;
+static uint64 g_Batch_Start = 0;
+static _Atomic uint32 g_Active_Workers = 0;
+
+/* Cycles consumed by every release of the current tick and whether it ran, written by the worker running it,
+   then the batch generation is stored in g_Release_Done to publish them */
+static uint32 g_Release_Cycles[OS_CONFIGURED_TASKS];
+static boolean g_Release_Ran[OS_CONFIGURED_TASKS];
+static _Atomic uint32 g_Release_Done[OS_CONFIGURED_TASKS];
+
+/* Pool statistics */
+static uint64 g_Parallel_Ticks = 0;
+static _Atomic uint64 g_Stolen_Releases = 0;
+
+/* Scheduled releases run per task, compared between runs with different numbers of workers */
+static _Atomic uint64 g_Task_Releases[OS_CONFIGURED_TASKS];
+
+#if (SYSTICK_OS_TICK_DIRECT_CALL == STD_ON)
+extern void SYSTICK_OS_TICK_FUNCTION(void);
+#endif
+
+/*********************************************************************************************/
+/* Description: Return the time on the target core inside the release run by the calling worker ... the tick start
+ *              plus the cycles of the releases before it in schedule order, waiting for the ones not completed yet */
+static uint64 Os_HostBatchNow(void)
+{
+    uint64 clock = g_Batch_Start;
+    uint32 index;
+
+    for(index = 0; index < g_Release_Index; index++)
+    {
+        /* The earlier releases never wait for a later one, the lowest running release always progresses */
+        while(atomic_load_explicit(&g_Release_Done[index], memory_order_acquire) != g_Batch_Generation)
+        {
+            sched_yield();
+        }
+        clock += g_Release_Cycles[index];
+    }
+
+    return clock + (g_Thread_Clock - g_Release_Begin);
+}
+
+/*********************************************************************************************/
+/* Description: Return the virtual time of the calling thread */
+static uint64 Os_HostNow(void)
+{
+    return (g_In_Batch == TRUE) ? Os_HostBatchNow() : g_Virtual_Clock;
+}
+
+/*********************************************************************************************/
+/* Description: Simulated SysTick_Handler, ends the simulation after the last tick */
+static void Os_HostServeTick(void)
+{
+    uint8 index;
+
+    g_SysTick_Expiry += (uint64)g_SysTick_Reload + 1U;
+
+#if (SYSTICK_OS_TICK_DIRECT_CALL == STD_ON)
+    SYSTICK_OS_TICK_FUNCTION();
+#endif
+    for(index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++)
+    {
+        if((g_SysTick_Subscribers[index].Callback != NULL_PTR) && (--g_SysTick_Subscribers[index].Countdown == 0))
+        {
+            g_SysTick_Subscribers[index].Countdown = g_SysTick_Subscribers[index].Divisor;
+            g_SysTick_Subscribers[index].Callback();
+        }
+    }
+
+    g_Served_Ticks++;
+    if(g_Served_Ticks >= g_Tick_Limit)
+    {
+        /* No more interrupts while the atexit handlers read the Os statistics */
+        g_SysTick_Running = FALSE;
+        exit(EXIT_SUCCESS);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Advance the virtual clock of the scheduler thread and serve the ticks expiring meanwhile if not masked */
+static void Os_HostAdvance(uint64 Cycles)
+{
+    uint64 end = g_Virtual_Clock + Cycles;
+
+    while((g_Mask_Owned == FALSE) && (g_SysTick_Running == TRUE) && (g_SysTick_Expiry <= end))
+    {
+        if(g_SysTick_Expiry > g_Virtual_Clock)
+        {
+            g_Virtual_Clock = g_SysTick_Expiry;
+        }
+        Os_HostServeTick();
+    }
+    g_Virtual_Clock = end;
+}
+
+/*********************************************************************************************/
+/* Description: Take the first release of the own shard */
+static boolean Os_HostTake(uint8 Worker, uint32 * Index)
+{
+    uint64 range = atomic_load(&g_Shards[Worker].Range);
+
+    do
+    {
+        if(OS_HOST_RANGE_BEGIN(range) >= OS_HOST_RANGE_END(range))
+        {
+            return FALSE;
+        }
+    } while(!atomic_compare_exchange_weak(&g_Shards[Worker].Range, &range,
+                                          OS_HOST_RANGE(OS_HOST_RANGE_BEGIN(range) + 1U, OS_HOST_RANGE_END(range))));
+
+    *Index = OS_HOST_RANGE_BEGIN(range);
+    return TRUE;
+}
+
+/*********************************************************************************************/
+/* Description: Steal the back half of another shard, run its first release now and keep the rest in the own shard */
+static boolean Os_HostSteal(uint8 Worker, uint32 * Index)
+{
+    uint8 offset;
+    uint8 victim;
+    uint32 begin;
+    uint32 end;
+    uint32 count;
+    uint64 range;
+
+    for(offset = 1; offset < g_Workers; offset++)
+    {
+        victim = (uint8)((Worker + offset) % g_Workers);
+        range  = atomic_load(&g_Shards[victim].Range);
+        while(OS_HOST_RANGE_BEGIN(range) < OS_HOST_RANGE_END(range))
+        {
+            begin = OS_HOST_RANGE_BEGIN(range);
+            end   = OS_HOST_RANGE_END(range);
+            count = (end - begin + 1U) / 2U;
+            if(atomic_compare_exchange_weak(&g_Shards[victim].Range, &range, OS_HOST_RANGE(begin, end - count)))
+            {
+                /* The own shard is empty, the thieves reading it before this store see no release to take */
+                atomic_store(&g_Shards[Worker].Range, OS_HOST_RANGE(end - count + 1U, end));
+                atomic_fetch_add(&g_Stolen_Releases, count);
+                *Index = end - count;
+                return TRUE;
+            }
+        }
+    }
+
+    return FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Run releases of the current tick until no shard has any left and measure each one on the own clock */
+static void Os_HostWork(uint8 Worker)
+{
+    uint32 index;
+
+    g_Thread_Clock = g_Batch_Start;
+    g_In_Batch     = TRUE;
+
+    while((Os_HostTake(Worker, &index) == TRUE) || (Os_HostSteal(Worker, &index) == TRUE))
+    {
+        atomic_fetch_add_explicit(&g_Task_Releases[g_Batch_Tasks[index]], 1U, memory_order_relaxed);
+        g_Release_Index = index;
+        g_Release_Begin = g_Thread_Clock;
+        g_Release_Ran[index]    = g_Batch_Release(g_Batch_Tasks[index]);
+        g_Release_Cycles[index] = (uint32)(g_Thread_Clock - g_Release_Begin);
+        atomic_store_explicit(&g_Release_Done[index], g_Batch_Generation, memory_order_release);
+    }
+
+    g_In_Batch = FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Worker thread waiting for the ticks with enough releases to be sharded */
+static void * Os_HostWorkerThread(void * Arg)
+{
+    uint8 worker = (uint8)(uintptr_t)Arg;
+    uint32 generation = 0;
+
+    while(1)
+    {
+        pthread_mutex_lock(&g_Pool_Lock);
+        while(g_Batch_Generation == generation)
+        {
+            pthread_cond_wait(&g_Pool_Start, &g_Pool_Lock);
+        }
+        generation = g_Batch_Generation;
+        pthread_mutex_unlock(&g_Pool_Lock);
+
+        Os_HostWork(worker);
+        atomic_fetch_sub(&g_Active_Workers, 1U);
+    }
+
+    return NULL_PTR;
+}
+
+/*********************************************************************************************/
+void Os_HostRunReleases(const Os_TaskType * Tasks, uint16 Count, Os_HostReleaseFuncType Release, Os_HostRecordFuncType Record)
+{
+    uint16 entry;
+    uint8 worker;
+    uint64 start;
+    uint64 clock;
+
+    /* Few releases ... run them in order on the scheduler thread, the ticks are served as they expire */
+    if((g_Workers == 1U) || (Count < OS_HOST_MIN_PARALLEL_RELEASES) || (Count > OS_CONFIGURED_TASKS))
+    {
+        for(entry = 0; entry < Count; entry++)
+        {
+            atomic_fetch_add_explicit(&g_Task_Releases[Tasks[entry]], 1U, memory_order_relaxed);
+            start = g_Virtual_Clock;
+            if((Release(Tasks[entry]) == TRUE) && (Record != NULL_PTR))
+            {
+                Record(Tasks[entry], (uint32)start, (uint32)g_Virtual_Clock);
+            }
+        }
+        return;
+    }
+
+    for(worker = 0; worker < g_Workers; worker++)
+    {
+        atomic_store(&g_Shards[worker].Range, OS_HOST_RANGE(((uint32)Count * worker) / g_Workers,
+                                                           ((uint32)Count * (worker + 1U)) / g_Workers));
+    }
+    g_Batch_Tasks   = Tasks;
+    g_Batch_Release = Release;
+    g_Batch_Start   = g_Virtual_Clock;
+    atomic_store(&g_Active_Workers, (uint32)g_Workers - 1U);
+
+    pthread_mutex_lock(&g_Pool_Lock);
+    g_Batch_Generation++;
+    pthread_cond_broadcast(&g_Pool_Start);
+    pthread_mutex_unlock(&g_Pool_Lock);
+
+    /* The scheduler thread is worker 0, then waits for the others to leave the tick */
+    Os_HostWork(0);
+    while(atomic_load(&g_Active_Workers) != 0U)
+    {
+        sched_yield();
+    }
+    g_Parallel_Ticks++;
+
+    /* One target core ran the releases one after the other ... each starts where the previous one ended */
+    clock = g_Batch_Start;
+    for(entry = 0; entry < Count; entry++)
+    {
+        start  = clock;
+        clock += g_Release_Cycles[entry];
+        if((g_Release_Ran[entry] == TRUE) && (Record != NULL_PTR))
+        {
+            Record(Tasks[entry], (uint32)start, (uint32)clock);
+        }
+    }
+    Os_HostAdvance(clock - g_Batch_Start);
+}
+
+/*********************************************************************************************/
+void Os_HostInit(uint64 Ticks, uint8 Workers)
+{
+    uint8 worker;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    g_Tick_Limit = Ticks;
+    g_Workers    = (Workers == 0U) ? 1U : ((Workers > OS_HOST_MAX_WORKERS) ? OS_HOST_MAX_WORKERS : Workers);
+
+    /* Oversubscribed workers only take turns on the CPUs and spin on each other ... run serially instead */
+    if((cpus > 0) && (g_Workers > cpus))
+    {
+        g_Workers = 1;
+    }
+
+    for(worker = 1; worker < g_Workers; worker++)
+    {
+        if(pthread_create(&g_Threads[worker], NULL_PTR, Os_HostWorkerThread, (void *)(uintptr_t)worker) != 0)
+        {
+            /* Run with the threads created so far */
+            g_Workers = worker;
+            break;
+        }
+    }
+}
+
+/*********************************************************************************************/
+void Os_HostConsume(uint32 Cycles)
+{
+    if(g_In_Batch == TRUE)
+    {
+        g_Thread_Clock += Cycles;
+    }
+    else
+    {
+        Os_HostAdvance(Cycles);
+    }
+}
+
+/*********************************************************************************************/
+uint64 Os_HostGetVirtualTime(void)
+{
+    return g_Virtual_Clock;
+}
+
+/*********************************************************************************************/
+uint8 Os_HostGetWorkers(void)
+{
+    return g_Workers;
+}
+
+/*********************************************************************************************/
+uint64 Os_HostGetParallelTicks(void)
+{
+    return g_Parallel_Ticks;
+}
+
+/*********************************************************************************************/
+uint64 Os_HostGetStolenReleases(void)
+{
+    return atomic_load(&g_Stolen_Releases);
+}
+
+/*********************************************************************************************/
+uint64 Os_HostGetTaskReleases(Os_TaskType Task)
+{
+    return atomic_load(&g_Task_Releases[Task]);
+}
+
+/*******************************************************************************
+ *                      Os Host Build Interface                                *
+ *******************************************************************************/
+
+/*********************************************************************************************/
+void Os_HostDisableInterrupts(void)
+{
+    if(g_Mask_Owned == FALSE)
+    {
+        pthread_mutex_lock(&g_Interrupt_Mask);
+        g_Mask_Owned = TRUE;
+    }
+}
+
+/*********************************************************************************************/
+void Os_HostEnableInterrupts(void)
+{
+    if(g_Mask_Owned == TRUE)
+    {
+        g_Mask_Owned = FALSE;
+        pthread_mutex_unlock(&g_Interrupt_Mask);
+    }
+
+    /* The pending interrupt is served here */
+    if(g_In_Batch == FALSE)
+    {
+        Os_HostAdvance(0);
+    }
+}
+
+/*********************************************************************************************/
+void Os_HostWaitForInterrupt(void)
+{
+    /* Sleep until the next SysTick expiry, the only interrupt of the simulated core */
+    if(g_SysTick_Running == FALSE)
+    {
+        exit(EXIT_SUCCESS);
+    }
+    if(g_Virtual_Clock < g_SysTick_Expiry)
+    {
+        g_Virtual_Clock = g_SysTick_Expiry;
+    }
+}
+
+/*********************************************************************************************/
+uint32 Os_HostCycleCounter(void)
+{
+    return (uint32)Os_HostNow();
+}
+
+/*******************************************************************************
+ *                      Simulated Gpt Driver                                   *
+ *******************************************************************************/
+
+/*********************************************************************************************/
+void SysTick_Start(uint16 Tick_Time)
+{
+    /* Same reload value as the target driver, the Os tick is never a chained period */
+    g_SysTick_Reload  = ((OS_HOST_CORE_CLOCK / 1000U) * Tick_Time) - 1U;
+    g_SysTick_Expiry  = g_Virtual_Clock + g_SysTick_Reload + 1U;
+    g_SysTick_Running = TRUE;
+}
+
+/*********************************************************************************************/
+void SysTick_Stop(void)
+{
+    g_SysTick_Running = FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Mask the simulated interrupts, return TRUE if they were already masked */
+static boolean Os_HostEnterCritical(void)
+{
+    boolean owned = g_Mask_Owned;
+
+    Os_HostDisableInterrupts();
+    return owned;
+}
+
+/*********************************************************************************************/
+/* Description: Restore the simulated mask without serving the pending interrupt */
+static void Os_HostExitCritical(boolean Owned)
+{
+    if(Owned == FALSE)
+    {
+        g_Mask_Owned = FALSE;
+        pthread_mutex_unlock(&g_Interrupt_Mask);
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType SysTick_AddSubscriber(void (*Ptr2Func)(void), uint16 Divisor)
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint8 index;
+    uint8 free_index = SYSTICK_MAX_SUBSCRIBERS;
+    boolean owned;
+
+    if((Ptr2Func != NULL_PTR) && (Divisor != 0))
+    {
+        owned = Os_HostEnterCritical();
+        for(index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++)
+        {
+            if(g_SysTick_Subscribers[index].Callback == Ptr2Func)
+            {
+                free_index = SYSTICK_MAX_SUBSCRIBERS;
+                break;
+            }
+            else if((g_SysTick_Subscribers[index].Callback == NULL_PTR) && (free_index == SYSTICK_MAX_SUBSCRIBERS))
+            {
+                free_index = index;
+            }
+        }
+        if(free_index != SYSTICK_MAX_SUBSCRIBERS)
+        {
+            g_SysTick_Subscribers[free_index].Divisor   = Divisor;
+            g_SysTick_Subscribers[free_index].Countdown = Divisor;
+            g_SysTick_Subscribers[free_index].Callback  = Ptr2Func;
+            status = E_OK;
+        }
+        Os_HostExitCritical(owned);
+    }
+
+    return status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType SysTick_RemoveSubscriber(void (*Ptr2Func)(void))
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint8 index;
+    boolean owned;
+
+    if(Ptr2Func != NULL_PTR)
+    {
+        owned = Os_HostEnterCritical();
+        for(index = 0; index < SYSTICK_MAX_SUBSCRIBERS; index++)
+        {
+            if(g_SysTick_Subscribers[index].Callback == Ptr2Func)
+            {
+                g_SysTick_Subscribers[index].Callback = NULL_PTR;
+                status = E_OK;
+                break;
+            }
+        }
+        Os_HostExitCritical(owned);
+    }
+
+    return status;
+}
+
+/*********************************************************************************************/
+uint32 SysTick_GetTimeElapsed(void)
+{
+    uint64 now = Os_HostNow();
+    uint64 period = (uint64)g_SysTick_Reload + 1U;
+
+    /* After an unserved expiry the timer has reloaded and keeps counting */
+    if(now >= g_SysTick_Expiry)
+    {
+        return (uint32)((now - g_SysTick_Expiry) % period);
+    }
+    return (uint32)(period - (g_SysTick_Expiry - now));
+}
+
+/*********************************************************************************************/
+uint32 SysTick_GetTimeRemaining(void)
+{
+    return g_SysTick_Reload - SysTick_GetTimeElapsed();
+}
+
+/*********************************************************************************************/
+boolean SysTick_IsInterruptPending(void)
+{
+    return (Os_HostNow() >= g_SysTick_Expiry) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+Std_ReturnType SysTick_AdjustTimeRemaining(sint32 Delta)
+{
+    /* Not simulated ... the tickless idle keeps the normal ticks */
+    (void)Delta;
+    return E_NOT_OK;
+}
+
+/*********************************************************************************************/
+void Timer0A_Init(void)
+{
+    /* The budgets are not enforced on the host */
+}
+
+/*********************************************************************************************/
+void Timer0A_StartOneShot(uint32 Counts)
+{
+    (void)Counts;
+}
+
+/*********************************************************************************************/
+uint32 Timer0A_Stop(void)
+{
+    return 0;
+}
+
+/*********************************************************************************************/
+void Timer0A_ClearInterrupt(void)
+{
+}
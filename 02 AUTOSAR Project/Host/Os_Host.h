@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Host.h
+ *
+ * Description: Header file of the host simulator running the Os scheduler on a Linux PC.
+ *              The Os, its tables (Os_Cfg.h / Os_PBcfg.c) and Det are compiled unchanged with OS_HOST_BUILD,
+ *              this layer replaces the SysTick and Timer0A drivers with a virtual 16 MHz core and runs
+ *              the releases of every tick on a work-stealing pool of worker threads.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef OS_HOST_H_
+#define OS_HOST_H_
+
+#include "Std_Types.h"
+#include "Mcu_Cfg.h"
+#include "Os.h"
+
+/* Frequency of the simulated core in Hz (system clock counted by SysTick, Timer0A and the DWT) */
+#define OS_HOST_CORE_CLOCK                  MCU_SYS_CLOCK_FREQUENCY
+
+/* Simulated core cycles per us */
+#define OS_HOST_CYCLES_PER_US               (OS_HOST_CORE_CLOCK / 1000000U)
+
+/* Maximum number of worker threads including the scheduler thread */
+#define OS_HOST_MAX_WORKERS                 (64U)
+
+/* The releases of a tick run on the scheduler thread only when they are fewer than this (not worth waking the pool) */
+#ifndef OS_HOST_MIN_PARALLEL_RELEASES
+#define OS_HOST_MIN_PARALLEL_RELEASES       (16U)
+#endif
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Start the worker threads and set the number of Os ticks to simulate,
+ *              the process exits (running the atexit handlers) once the last tick is served.
+ *              With one worker, or more workers than online CPUs, everything runs on the scheduler thread.
+ */
+void Os_HostInit(uint64 Ticks, uint8 Workers);
+
+/* Description: Called by the task models to spend simulated CPU time on the calling thread */
+void Os_HostConsume(uint32 Cycles);
+
+/* Description: Return the simulated time in cycles since SysTick_Start */
+uint64 Os_HostGetVirtualTime(void);
+
+/* Description: Return the number of threads running the releases, 1 if the requested workers fell back to serial */
+uint8 Os_HostGetWorkers(void);
+
+/* Description: Return the number of the ticks whose releases were sharded over the pool and the releases stolen between workers */
+uint64 Os_HostGetParallelTicks(void);
+uint64 Os_HostGetStolenReleases(void);
+
+/* Description: Return the number of the scheduled releases of a task run so far */
+uint64 Os_HostGetTaskReleases(Os_TaskType Task);
+
+#endif /* OS_HOST_H_ */
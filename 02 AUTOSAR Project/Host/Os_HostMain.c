@@ -0,0 +1,238 @@
+ /******************************************************************************
+ *
+ * Module: Main
+ *
+ * File Name: Os_HostMain.c
+ *
+ * Description: Main function of the host simulator ... runs the Os for a number of ticks then prints
+ *              the task statistics, the CPU load and the missed ticks of the simulated schedule.
+ *
+ *              ./Os_Host [ticks] [workers] [verify]
+ *                  ticks   - Os ticks to simulate (default one week of virtual time)
+ *                  workers - threads sharing the releases of a tick (default the number of online CPUs)
+ *                  verify  - also run the same ticks with one worker in a child process and exit with
+ *                            EXIT_FAILURE if any task has different releases, execution or response times
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "Os.h"
+#include "Os_Host.h"
+
+/* One week of Os ticks */
+#define HOST_DEFAULT_TICKS                  ((uint64)7U * 24U * 3600U * 1000U / OS_BASE_TIME)
+
+/* Wall clock at the start of the simulation */
+static struct timespec g_Wall_Start;
+
+/* Results of a task compared between the verified run and the 1-worker reference run */
+typedef struct
+{
+    uint64 Releases;
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    Os_TaskTimeStatsType Stats;
+#endif
+} Host_TaskResultType;
+
+/* Pipe carrying the task results of the 1-worker reference run to the verified run, -1 when not verifying */
+static int g_Verify_Pipe[2] = {-1, -1};
+static pid_t g_Verify_Child = -1;
+
+/*********************************************************************************************/
+/* Description: Fill Result with the releases and the time statistics of a task */
+static void Host_GetTaskResult(Os_TaskType Task, Host_TaskResultType * Result)
+{
+    memset(Result, 0, sizeof(*Result));
+    Result->Releases = Os_HostGetTaskReleases(Task);
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    (void)Os_GetTaskTimeStats(Task, &Result->Stats);
+#endif
+}
+
+/*********************************************************************************************/
+/* Description: Return TRUE if two results of a task are the same */
+static boolean Host_SameTaskResult(const Host_TaskResultType * Result, const Host_TaskResultType * Reference)
+{
+    boolean same = (Result->Releases == Reference->Releases) ? TRUE : FALSE;
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    if((Result->Stats.MinExecutionTime != Reference->Stats.MinExecutionTime) ||
+       (Result->Stats.MaxExecutionTime != Reference->Stats.MaxExecutionTime) ||
+       (Result->Stats.AvgExecutionTime != Reference->Stats.AvgExecutionTime) ||
+       (Result->Stats.MinResponseTime  != Reference->Stats.MinResponseTime)  ||
+       (Result->Stats.MaxResponseTime  != Reference->Stats.MaxResponseTime)  ||
+       (Result->Stats.AvgResponseTime  != Reference->Stats.AvgResponseTime)  ||
+       (Result->Stats.Activations      != Reference->Stats.Activations))
+    {
+        same = FALSE;
+    }
+#endif
+    return same;
+}
+
+/*********************************************************************************************/
+/* Description: Compare the results of every task with the ones of the 1-worker reference run */
+static void Host_Verify(void)
+{
+    Os_TaskType task;
+    Host_TaskResultType result;
+    Host_TaskResultType reference[OS_CONFIGURED_TASKS];
+    size_t received = 0;
+    ssize_t length;
+    int status;
+    uint16 mismatches = 0;
+
+    while(received < sizeof(reference))
+    {
+        length = read(g_Verify_Pipe[0], (uint8 *)reference + received, sizeof(reference) - received);
+        if(length <= 0)
+        {
+            break;
+        }
+        received += (size_t)length;
+    }
+    (void)waitpid(g_Verify_Child, &status, 0);
+
+    if(received != sizeof(reference))
+    {
+        printf("\nVerify: the 1-worker reference run did not report its task results\n");
+        mismatches++;
+    }
+    else
+    {
+        for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+        {
+            Host_GetTaskResult(task, &result);
+            if(Host_SameTaskResult(&result, &reference[task]) == FALSE)
+            {
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+                printf("Verify: task %u released %llu times, response max %lu avg %lu cycles ... "
+                       "%llu times, response max %lu avg %lu cycles with one worker\n", (unsigned)task,
+                       (unsigned long long)result.Releases, (unsigned long)result.Stats.MaxResponseTime,
+                       (unsigned long)result.Stats.AvgResponseTime, (unsigned long long)reference[task].Releases,
+                       (unsigned long)reference[task].Stats.MaxResponseTime, (unsigned long)reference[task].Stats.AvgResponseTime);
+#else
+                printf("Verify: task %u released %llu times, %llu times with one worker\n", (unsigned)task,
+                       (unsigned long long)result.Releases, (unsigned long long)reference[task].Releases);
+#endif
+                mismatches++;
+            }
+        }
+        printf("\nVerify: %u task(s) differ from the 1-worker run\n", (unsigned)mismatches);
+    }
+
+    if(mismatches != 0U)
+    {
+        /* exit() must not be called again from an atexit handler */
+        fflush(stdout);
+        _exit(EXIT_FAILURE);
+    }
+}
+
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+/*********************************************************************************************/
+/* Description: Return the time in us of a number of cycles of the simulated core */
+static double Host_CyclesToUs(uint32 Cycles)
+{
+    return (double)Cycles / OS_HOST_CYCLES_PER_US;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Called at exit once the last tick is served, print the report of the simulation */
+static void Host_Report(void)
+{
+    struct timespec wall_end;
+    double wall;
+    Os_TaskType task;
+    Host_TaskResultType results[OS_CONFIGURED_TASKS];
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+    Os_TaskTimeStatsType stats;
+#endif
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+    Os_CpuLoadType load;
+#endif
+
+    if(g_Verify_Child == 0)
+    {
+        /* 1-worker reference run ... send the task results, the report is printed by the verified run only */
+        for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+        {
+            Host_GetTaskResult(task, &results[task]);
+        }
+        (void)write(g_Verify_Pipe[1], results, sizeof(results));
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    wall = (double)(wall_end.tv_sec - g_Wall_Start.tv_sec) + ((double)(wall_end.tv_nsec - g_Wall_Start.tv_nsec) / 1e9);
+
+    printf("Simulated %.1f s (%lu ticks) in %.2f s of wall time\n",
+           (double)Os_HostGetVirtualTime() / OS_HOST_CORE_CLOCK, (unsigned long)Os_GetTickCount(), wall);
+    printf("Workers %u, sharded ticks %llu, stolen releases %llu\n\n", (unsigned)Os_HostGetWorkers(),
+           (unsigned long long)Os_HostGetParallelTicks(), (unsigned long long)Os_HostGetStolenReleases());
+
+    printf("Task  Releases  Activations  Exec min/avg/max us        Response min/avg/max us    Overruns\n");
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+#if (OS_EXECUTION_TIME_STATS == STD_ON)
+        (void)Os_GetTaskTimeStats(task, &stats);
+        printf("%4u  %8llu  %11lu  %7.1f %7.1f %7.1f    %7.1f %7.1f %7.1f    %8u\n", (unsigned)task,
+               (unsigned long long)Os_HostGetTaskReleases(task), (unsigned long)stats.Activations,
+               Host_CyclesToUs(stats.MinExecutionTime), Host_CyclesToUs(stats.AvgExecutionTime), Host_CyclesToUs(stats.MaxExecutionTime),
+               Host_CyclesToUs(stats.MinResponseTime), Host_CyclesToUs(stats.AvgResponseTime), Host_CyclesToUs(stats.MaxResponseTime),
+               (unsigned)Os_GetTaskOverrunCount(task));
+#else
+        printf("%4u  %8llu  %65s%8u\n", (unsigned)task, (unsigned long long)Os_HostGetTaskReleases(task), "",
+               (unsigned)Os_GetTaskOverrunCount(task));
+#endif
+    }
+
+#if (OS_CPU_LOAD_MONITOR == STD_ON)
+    Os_GetCpuLoad(&load);
+    printf("\nCPU load current %.2f %%, average %.2f %%, peak %.2f %%, overloaded hyperperiods %lu\n",
+           load.Current / 100.0, load.Average / 100.0, load.Peak / 100.0, (unsigned long)load.Overloads);
+#endif
+    printf("Missed ticks %lu, skipped ticks %lu\n", (unsigned long)Os_GetMissedTickCount(), (unsigned long)Os_GetSkippedTickCount());
+#if (OS_DEFERRED_WORK == STD_ON)
+    printf("Dropped deferred work %lu\n", (unsigned long)Os_GetDeferredWorkDropCount());
+#endif
+
+    if(g_Verify_Child > 0)
+    {
+        Host_Verify();
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    uint64 ticks = (argc > 1) ? strtoull(argv[1], NULL_PTR, 0) : HOST_DEFAULT_TICKS;
+    long workers = (argc > 2) ? strtol(argv[2], NULL_PTR, 0) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* The reference run is forked before the worker threads exist, both runs simulate the same ticks in parallel */
+    if((argc > 3) && (strcmp(argv[3], "verify") == 0))
+    {
+        if((pipe(g_Verify_Pipe) != 0) || ((g_Verify_Child = fork()) < 0))
+        {
+            perror("verify");
+            return EXIT_FAILURE;
+        }
+        workers = (g_Verify_Child == 0) ? 1 : workers;
+    }
+
+    Os_HostInit(ticks, (uint8)((workers < 1) ? 1 : ((workers > OS_HOST_MAX_WORKERS) ? OS_HOST_MAX_WORKERS : workers)));
+
+    clock_gettime(CLOCK_MONOTONIC, &g_Wall_Start);
+    atexit(Host_Report);
+
+    /* Start the Os ... returns through exit() after the last tick */
+    Os_start();
+
+    return 0;
+}
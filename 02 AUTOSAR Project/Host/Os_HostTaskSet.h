@@ -0,0 +1,275 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_HostTaskSet.h
+ *
+ * Description: Large task set of the host simulator, included by Os_Cfg.h when building with OS_HOST_BUILD and
+ *              OS_HOST_LARGE_TASK_SET. The 250 load tasks are appended to the Button, App and Led Tasks so every
+ *              tick has more than OS_HOST_MIN_PARALLEL_RELEASES releases and is sharded over the worker pool.
+ *              App_Host.c models every load task by its WCET.
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#ifndef OS_HOST_TASK_SET_H_
+#define OS_HOST_TASK_SET_H_
+
+/*
+ * X(NAME, PERIOD, OFFSET, PRIORITY, WCET) ... period and offset in ms, WCET in us.
+ * 150 tasks every 20 ms and 100 tasks every 40 ms split over the two ticks of the hyperperiod,
+ * 200 load task releases and about 11 ms of load in every tick of every mode
+ */
+#define OS_EXTRA_TASKS(X) \
+    X(LOAD000, 20U,  0U,   3U, 40U) \
+    X(LOAD001, 20U,  0U,   4U, 50U) \
+    X(LOAD002, 20U,  0U,   5U, 60U) \
+    X(LOAD003, 20U,  0U,   6U, 70U) \
+    X(LOAD004, 20U,  0U,   7U, 40U) \
+    X(LOAD005, 20U,  0U,   8U, 50U) \
+    X(LOAD006, 20U,  0U,   9U, 60U) \
+    X(LOAD007, 20U,  0U,  10U, 70U) \
+    X(LOAD008, 20U,  0U,  11U, 40U) \
+    X(LOAD009, 20U,  0U,  12U, 50U) \
+    X(LOAD010, 20U,  0U,  13U, 60U) \
+    X(LOAD011, 20U,  0U,  14U, 70U) \
+    X(LOAD012, 20U,  0U,  15U, 40U) \
+    X(LOAD013, 20U,  0U,  16U, 50U) \
+    X(LOAD014, 20U,  0U,  17U, 60U) \
+    X(LOAD015, 20U,  0U,  18U, 70U) \
+    X(LOAD016, 20U,  0U,  19U, 40U) \
+    X(LOAD017, 20U,  0U,  20U, 50U) \
+    X(LOAD018, 20U,  0U,  21U, 60U) \
+    X(LOAD019, 20U,  0U,  22U, 70U) \
+    X(LOAD020, 20U,  0U,  23U, 40U) \
+    X(LOAD021, 20U,  0U,  24U, 50U) \
+    X(LOAD022, 20U,  0U,  25U, 60U) \
+    X(LOAD023, 20U,  0U,  26U, 70U) \
+    X(LOAD024, 20U,  0U,  27U, 40U) \
+    X(LOAD025, 20U,  0U,  28U, 50U) \
+    X(LOAD026, 20U,  0U,  29U, 60U) \
+    X(LOAD027, 20U,  0U,  30U, 70U) \
+    X(LOAD028, 20U,  0U,  31U, 40U) \
+    X(LOAD029, 20U,  0U,  32U, 50U) \
+    X(LOAD030, 20U,  0U,  33U, 60U) \
+    X(LOAD031, 20U,  0U,  34U, 70U) \
+    X(LOAD032, 20U,  0U,  35U, 40U) \
+    X(LOAD033, 20U,  0U,  36U, 50U) \
+    X(LOAD034, 20U,  0U,  37U, 60U) \
+    X(LOAD035, 20U,  0U,  38U, 70U) \
+    X(LOAD036, 20U,  0U,  39U, 40U) \
+    X(LOAD037, 20U,  0U,  40U, 50U) \
+    X(LOAD038, 20U,  0U,  41U, 60U) \
+    X(LOAD039, 20U,  0U,  42U, 70U) \
+    X(LOAD040, 20U,  0U,  43U, 40U) \
+    X(LOAD041, 20U,  0U,  44U, 50U) \
+    X(LOAD042, 20U,  0U,  45U, 60U) \
+    X(LOAD043, 20U,  0U,  46U, 70U) \
+    X(LOAD044, 20U,  0U,  47U, 40U) \
+    X(LOAD045, 20U,  0U,  48U, 50U) \
+    X(LOAD046, 20U,  0U,  49U, 60U) \
+    X(LOAD047, 20U,  0U,  50U, 70U) \
+    X(LOAD048, 20U,  0U,  51U, 40U) \
+    X(LOAD049, 20U,  0U,  52U, 50U) \
+    X(LOAD050, 20U,  0U,  53U, 60U) \
+    X(LOAD051, 20U,  0U,  54U, 70U) \
+    X(LOAD052, 20U,  0U,  55U, 40U) \
+    X(LOAD053, 20U,  0U,  56U, 50U) \
+    X(LOAD054, 20U,  0U,  57U, 60U) \
+    X(LOAD055, 20U,  0U,  58U, 70U) \
+    X(LOAD056, 20U,  0U,  59U, 40U) \
+    X(LOAD057, 20U,  0U,  60U, 50U) \
+    X(LOAD058, 20U,  0U,  61U, 60U) \
+    X(LOAD059, 20U,  0U,  62U, 70U) \
+    X(LOAD060, 20U,  0U,  63U, 40U) \
+    X(LOAD061, 20U,  0U,  64U, 50U) \
+    X(LOAD062, 20U,  0U,  65U, 60U) \
+    X(LOAD063, 20U,  0U,  66U, 70U) \
+    X(LOAD064, 20U,  0U,  67U, 40U) \
+    X(LOAD065, 20U,  0U,  68U, 50U) \
+    X(LOAD066, 20U,  0U,  69U, 60U) \
+    X(LOAD067, 20U,  0U,  70U, 70U) \
+    X(LOAD068, 20U,  0U,  71U, 40U) \
+    X(LOAD069, 20U,  0U,  72U, 50U) \
+    X(LOAD070, 20U,  0U,  73U, 60U) \
+    X(LOAD071, 20U,  0U,  74U, 70U) \
+    X(LOAD072, 20U,  0U,  75U, 40U) \
+    X(LOAD073, 20U,  0U,  76U, 50U) \
+    X(LOAD074, 20U,  0U,  77U, 60U) \
+    X(LOAD075, 20U,  0U,  78U, 70U) \
+    X(LOAD076, 20U,  0U,  79U, 40U) \
+    X(LOAD077, 20U,  0U,  80U, 50U) \
+    X(LOAD078, 20U,  0U,  81U, 60U) \
+    X(LOAD079, 20U,  0U,  82U, 70U) \
+    X(LOAD080, 20U,  0U,  83U, 40U) \
+    X(LOAD081, 20U,  0U,  84U, 50U) \
+    X(LOAD082, 20U,  0U,  85U, 60U) \
+    X(LOAD083, 20U,  0U,  86U, 70U) \
+    X(LOAD084, 20U,  0U,  87U, 40U) \
+    X(LOAD085, 20U,  0U,  88U, 50U) \
+    X(LOAD086, 20U,  0U,  89U, 60U) \
+    X(LOAD087, 20U,  0U,  90U, 70U) \
+    X(LOAD088, 20U,  0U,  91U, 40U) \
+    X(LOAD089, 20U,  0U,  92U, 50U) \
+    X(LOAD090, 20U,  0U,  93U, 60U) \
+    X(LOAD091, 20U,  0U,  94U, 70U) \
+    X(LOAD092, 20U,  0U,  95U, 40U) \
+    X(LOAD093, 20U,  0U,  96U, 50U) \
+    X(LOAD094, 20U,  0U,  97U, 60U) \
+    X(LOAD095, 20U,  0U,  98U, 70U) \
+    X(LOAD096, 20U,  0U,  99U, 40U) \
+    X(LOAD097, 20U,  0U, 100U, 50U) \
+    X(LOAD098, 20U,  0U, 101U, 60U) \
+    X(LOAD099, 20U,  0U, 102U, 70U) \
+    X(LOAD100, 20U,  0U, 103U, 40U) \
+    X(LOAD101, 20U,  0U, 104U, 50U) \
+    X(LOAD102, 20U,  0U, 105U, 60U) \
+    X(LOAD103, 20U,  0U, 106U, 70U) \
+    X(LOAD104, 20U,  0U, 107U, 40U) \
+    X(LOAD105, 20U,  0U, 108U, 50U) \
+    X(LOAD106, 20U,  0U, 109U, 60U) \
+    X(LOAD107, 20U,  0U, 110U, 70U) \
+    X(LOAD108, 20U,  0U, 111U, 40U) \
+    X(LOAD109, 20U,  0U, 112U, 50U) \
+    X(LOAD110, 20U,  0U, 113U, 60U) \
+    X(LOAD111, 20U,  0U, 114U, 70U) \
+    X(LOAD112, 20U,  0U, 115U, 40U) \
+    X(LOAD113, 20U,  0U, 116U, 50U) \
+    X(LOAD114, 20U,  0U, 117U, 60U) \
+    X(LOAD115, 20U,  0U, 118U, 70U) \
+    X(LOAD116, 20U,  0U, 119U, 40U) \
+    X(LOAD117, 20U,  0U, 120U, 50U) \
+    X(LOAD118, 20U,  0U, 121U, 60U) \
+    X(LOAD119, 20U,  0U, 122U, 70U) \
+    X(LOAD120, 20U,  0U, 123U, 40U) \
+    X(LOAD121, 20U,  0U, 124U, 50U) \
+    X(LOAD122, 20U,  0U, 125U, 60U) \
+    X(LOAD123, 20U,  0U, 126U, 70U) \
+    X(LOAD124, 20U,  0U, 127U, 40U) \
+    X(LOAD125, 20U,  0U, 128U, 50U) \
+    X(LOAD126, 20U,  0U, 129U, 60U) \
+    X(LOAD127, 20U,  0U, 130U, 70U) \
+    X(LOAD128, 20U,  0U, 131U, 40U) \
+    X(LOAD129, 20U,  0U, 132U, 50U) \
+    X(LOAD130, 20U,  0U, 133U, 60U) \
+    X(LOAD131, 20U,  0U, 134U, 70U) \
+    X(LOAD132, 20U,  0U, 135U, 40U) \
+    X(LOAD133, 20U,  0U, 136U, 50U) \
+    X(LOAD134, 20U,  0U, 137U, 60U) \
+    X(LOAD135, 20U,  0U, 138U, 70U) \
+    X(LOAD136, 20U,  0U, 139U, 40U) \
+    X(LOAD137, 20U,  0U, 140U, 50U) \
+    X(LOAD138, 20U,  0U, 141U, 60U) \
+    X(LOAD139, 20U,  0U, 142U, 70U) \
+    X(LOAD140, 20U,  0U, 143U, 40U) \
+    X(LOAD141, 20U,  0U, 144U, 50U) \
+    X(LOAD142, 20U,  0U, 145U, 60U) \
+    X(LOAD143, 20U,  0U, 146U, 70U) \
+    X(LOAD144, 20U,  0U, 147U, 40U) \
+    X(LOAD145, 20U,  0U, 148U, 50U) \
+    X(LOAD146, 20U,  0U, 149U, 60U) \
+    X(LOAD147, 20U,  0U, 150U, 70U) \
+    X(LOAD148, 20U,  0U, 151U, 40U) \
+    X(LOAD149, 20U,  0U, 152U, 50U) \
+    X(LOAD150, 40U,  0U, 153U, 60U) \
+    X(LOAD151, 40U, 20U, 154U, 70U) \
+    X(LOAD152, 40U,  0U, 155U, 40U) \
+    X(LOAD153, 40U, 20U, 156U, 50U) \
+    X(LOAD154, 40U,  0U, 157U, 60U) \
+    X(LOAD155, 40U, 20U, 158U, 70U) \
+    X(LOAD156, 40U,  0U, 159U, 40U) \
+    X(LOAD157, 40U, 20U, 160U, 50U) \
+    X(LOAD158, 40U,  0U, 161U, 60U) \
+    X(LOAD159, 40U, 20U, 162U, 70U) \
+    X(LOAD160, 40U,  0U, 163U, 40U) \
+    X(LOAD161, 40U, 20U, 164U, 50U) \
+    X(LOAD162, 40U,  0U, 165U, 60U) \
+    X(LOAD163, 40U, 20U, 166U, 70U) \
+    X(LOAD164, 40U,  0U, 167U, 40U) \
+    X(LOAD165, 40U, 20U, 168U, 50U) \
+    X(LOAD166, 40U,  0U, 169U, 60U) \
+    X(LOAD167, 40U, 20U, 170U, 70U) \
+    X(LOAD168, 40U,  0U, 171U, 40U) \
+    X(LOAD169, 40U, 20U, 172U, 50U) \
+    X(LOAD170, 40U,  0U, 173U, 60U) \
+    X(LOAD171, 40U, 20U, 174U, 70U) \
+    X(LOAD172, 40U,  0U, 175U, 40U) \
+    X(LOAD173, 40U, 20U, 176U, 50U) \
+    X(LOAD174, 40U,  0U, 177U, 60U) \
+    X(LOAD175, 40U, 20U, 178U, 70U) \
+    X(LOAD176, 40U,  0U, 179U, 40U) \
+    X(LOAD177, 40U, 20U, 180U, 50U) \
+    X(LOAD178, 40U,  0U, 181U, 60U) \
+    X(LOAD179, 40U, 20U, 182U, 70U) \
+    X(LOAD180, 40U,  0U, 183U, 40U) \
+    X(LOAD181, 40U, 20U, 184U, 50U) \
+    X(LOAD182, 40U,  0U, 185U, 60U) \
+    X(LOAD183, 40U, 20U, 186U, 70U) \
+    X(LOAD184, 40U,  0U, 187U, 40U) \
+    X(LOAD185, 40U, 20U, 188U, 50U) \
+    X(LOAD186, 40U,  0U, 189U, 60U) \
+    X(LOAD187, 40U, 20U, 190U, 70U) \
+    X(LOAD188, 40U,  0U, 191U, 40U) \
+    X(LOAD189, 40U, 20U, 192U, 50U) \
+    X(LOAD190, 40U,  0U, 193U, 60U) \
+    X(LOAD191, 40U, 20U, 194U, 70U) \
+    X(LOAD192, 40U,  0U, 195U, 40U) \
+    X(LOAD193, 40U, 20U, 196U, 50U) \
+    X(LOAD194, 40U,  0U, 197U, 60U) \
+    X(LOAD195, 40U, 20U, 198U, 70U) \
+    X(LOAD196, 40U,  0U, 199U, 40U) \
+    X(LOAD197, 40U, 20U, 200U, 50U) \
+    X(LOAD198, 40U,  0U, 201U, 60U) \
+    X(LOAD199, 40U, 20U, 202U, 70U) \
+    X(LOAD200, 40U,  0U, 203U, 40U) \
+    X(LOAD201, 40U, 20U, 204U, 50U) \
+    X(LOAD202, 40U,  0U, 205U, 60U) \
+    X(LOAD203, 40U, 20U, 206U, 70U) \
+    X(LOAD204, 40U,  0U, 207U, 40U) \
+    X(LOAD205, 40U, 20U, 208U, 50U) \
+    X(LOAD206, 40U,  0U, 209U, 60U) \
+    X(LOAD207, 40U, 20U, 210U, 70U) \
+    X(LOAD208, 40U,  0U, 211U, 40U) \
+    X(LOAD209, 40U, 20U, 212U, 50U) \
+    X(LOAD210, 40U,  0U, 213U, 60U) \
+    X(LOAD211, 40U, 20U, 214U, 70U) \
+    X(LOAD212, 40U,  0U, 215U, 40U) \
+    X(LOAD213, 40U, 20U, 216U, 50U) \
+    X(LOAD214, 40U,  0U, 217U, 60U) \
+    X(LOAD215, 40U, 20U, 218U, 70U) \
+    X(LOAD216, 40U,  0U, 219U, 40U) \
+    X(LOAD217, 40U, 20U, 220U, 50U) \
+    X(LOAD218, 40U,  0U, 221U, 60U) \
+    X(LOAD219, 40U, 20U, 222U, 70U) \
+    X(LOAD220, 40U,  0U, 223U, 40U) \
+    X(LOAD221, 40U, 20U, 224U, 50U) \
+    X(LOAD222, 40U,  0U, 225U, 60U) \
+    X(LOAD223, 40U, 20U, 226U, 70U) \
+    X(LOAD224, 40U,  0U, 227U, 40U) \
+    X(LOAD225, 40U, 20U, 228U, 50U) \
+    X(LOAD226, 40U,  0U, 229U, 60U) \
+    X(LOAD227, 40U, 20U, 230U, 70U) \
+    X(LOAD228, 40U,  0U, 231U, 40U) \
+    X(LOAD229, 40U, 20U, 232U, 50U) \
+    X(LOAD230, 40U,  0U, 233U, 60U) \
+    X(LOAD231, 40U, 20U, 234U, 70U) \
+    X(LOAD232, 40U,  0U, 235U, 40U) \
+    X(LOAD233, 40U, 20U, 236U, 50U) \
+    X(LOAD234, 40U,  0U, 237U, 60U) \
+    X(LOAD235, 40U, 20U, 238U, 70U) \
+    X(LOAD236, 40U,  0U, 239U, 40U) \
+    X(LOAD237, 40U, 20U, 240U, 50U) \
+    X(LOAD238, 40U,  0U, 241U, 60U) \
+    X(LOAD239, 40U, 20U, 242U, 70U) \
+    X(LOAD240, 40U,  0U, 243U, 40U) \
+    X(LOAD241, 40U, 20U, 244U, 50U) \
+    X(LOAD242, 40U,  0U, 245U, 60U) \
+    X(LOAD243, 40U, 20U, 246U, 70U) \
+    X(LOAD244, 40U,  0U, 247U, 40U) \
+    X(LOAD245, 40U, 20U, 248U, 50U) \
+    X(LOAD246, 40U,  0U, 249U, 60U) \
+    X(LOAD247, 40U, 20U, 250U, 70U) \
+    X(LOAD248, 40U,  0U, 251U, 40U) \
+    X(LOAD249, 40U, 20U, 252U, 50U)
+
+#endif /* OS_HOST_TASK_SET_H_ */
@@ -0,0 +1,223 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_OffsetOptimizer.c
+ *
+ * Description: Host build-time tool choosing the task release offsets that minimize the peak load of one Os tick.
+ *              It reads the task periods of every application mode and the declared WCETs from Os_Cfg.h and
+ *              prints the offset lines to paste in Os_Cfg.h, the Os builds the dispatch schedule of every mode
+ *              from them at start-up. The offsets are shared by the modes, so every offset is kept below the
+ *              shortest period of its task in all the modes and the peak load is the highest one of all the modes.
+ *
+ *              Build and run from this folder:
+ *                  gcc -I../Application Os_OffsetOptimizer.c -o Os_OffsetOptimizer
+ *                  ./Os_OffsetOptimizer
+ *
+ * Author: Zeyad Hisham
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+
+/* Search budget ... beyond it the best schedule found so far is printed */
+#define TOOL_MAX_VISITED_NODES              (50000000UL)
+
+/* Task description used by the tool ... keep it in the order of Os_PBcfg.c and the periods in the order of the application modes */
+typedef struct
+{
+    const char * Name;
+    uint16 Periods[OS_CONFIGURED_APP_MODES];
+    uint16 Offset;
+    uint32 Wcet;
+} Tool_TaskType;
+
+static const Tool_TaskType g_Tasks[OS_CONFIGURED_TASKS] = {
+    {"BUTTON", {OsConf_BUTTON_TASK_PERIOD, OsConf_LOW_POWER_BUTTON_TASK_PERIOD, OsConf_DIAGNOSTIC_BUTTON_TASK_PERIOD},
+               OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_WCET},
+    {"APP",    {OsConf_APP_TASK_PERIOD,    OsConf_LOW_POWER_APP_TASK_PERIOD,    OsConf_DIAGNOSTIC_APP_TASK_PERIOD},
+               OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_WCET},
+    {"LED",    {OsConf_LED_TASK_PERIOD,    OsConf_LOW_POWER_LED_TASK_PERIOD,    OsConf_DIAGNOSTIC_LED_TASK_PERIOD},
+               OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_WCET}
+};
+
+/* Load of every tick of every mode in us while searching */
+static uint32 g_Tick_Load[OS_CONFIGURED_APP_MODES][OS_HYPERPERIOD_TICKS];
+
+/* Shortest period of every task in all the modes (0 for event tasks), the offsets are searched below it */
+static uint16 g_Min_Period[OS_CONFIGURED_TASKS];
+
+/* Periodic tasks sorted by decreasing WCET, the heavy tasks are placed first to prune early */
+static uint8 g_Order[OS_CONFIGURED_TASKS];
+static uint8 g_Periodic_Tasks = 0;
+
+/* Offsets being tried and the best ones found */
+static uint16 g_Offset[OS_CONFIGURED_TASKS];
+static uint16 g_Best_Offset[OS_CONFIGURED_TASKS];
+static uint32 g_Best_Peak;
+static uint64 g_Best_Spread;
+static uint32 g_Visited_Nodes = 0;
+
+/*********************************************************************************************/
+/* Description: Add (or remove if Sign is -1) the releases of a task with the given offset to the tick loads of every mode */
+static void Tool_Place(uint8 Task, uint16 Offset, sint32 Sign)
+{
+    uint8 mode;
+    uint16 time;
+    uint16 period;
+
+    for(mode = 0; mode < OS_CONFIGURED_APP_MODES; mode++)
+    {
+        /* Same release rule as Os_BuildSchedule, the task is shed in the modes where its period is 0 */
+        period = g_Tasks[Task].Periods[mode];
+        if(period != 0)
+        {
+            for(time = Offset; time < OS_HYPERPERIOD; time += period)
+            {
+                g_Tick_Load[mode][time / OS_BASE_TIME] += (uint32)(Sign * (sint32)g_Tasks[Task].Wcet);
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Return the peak tick load of all the modes and the sum of squares of the loads (lower is a flatter schedule) */
+static uint32 Tool_Peak(uint64 * Spread)
+{
+    uint8 mode;
+    uint16 tick;
+    uint32 peak = 0;
+
+    *Spread = 0;
+    for(mode = 0; mode < OS_CONFIGURED_APP_MODES; mode++)
+    {
+        for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+        {
+            if(g_Tick_Load[mode][tick] > peak)
+            {
+                peak = g_Tick_Load[mode][tick];
+            }
+            *Spread += (uint64)g_Tick_Load[mode][tick] * g_Tick_Load[mode][tick];
+        }
+    }
+
+    return peak;
+}
+
+/*********************************************************************************************/
+/* Description: Depth first search over the offsets of the periodic tasks with branch and bound on the peak load */
+static void Tool_Search(uint8 Depth)
+{
+    uint8 task;
+    uint16 offset;
+    uint32 peak;
+    uint64 spread;
+
+    g_Visited_Nodes++;
+    peak = Tool_Peak(&spread);
+
+    /* Placing more tasks never lowers the peak */
+    if((peak > g_Best_Peak) || (g_Visited_Nodes > TOOL_MAX_VISITED_NODES))
+    {
+        return;
+    }
+
+    if(Depth == g_Periodic_Tasks)
+    {
+        if((peak < g_Best_Peak) || (spread < g_Best_Spread))
+        {
+            g_Best_Peak   = peak;
+            g_Best_Spread = spread;
+            for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+            {
+                g_Best_Offset[task] = g_Offset[task];
+            }
+        }
+        return;
+    }
+
+    task = g_Order[Depth];
+    for(offset = 0; offset < g_Min_Period[task]; offset += OS_BASE_TIME)
+    {
+        g_Offset[task] = offset;
+        Tool_Place(task, offset, 1);
+        Tool_Search(Depth + 1);
+        Tool_Place(task, offset, -1);
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint8 task;
+    uint8 mode;
+    uint8 index;
+    uint8 swap;
+    uint32 peak;
+    char name[40];
+    uint64 spread;
+
+    /* Load of the configured offsets */
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        g_Min_Period[task] = 0;
+        for(mode = 0; mode < OS_CONFIGURED_APP_MODES; mode++)
+        {
+            if((g_Tasks[task].Periods[mode] != 0) &&
+               ((g_Min_Period[task] == 0) || (g_Tasks[task].Periods[mode] < g_Min_Period[task])))
+            {
+                g_Min_Period[task] = g_Tasks[task].Periods[mode];
+            }
+        }
+
+        if(g_Min_Period[task] != 0)
+        {
+            if(g_Tasks[task].Offset >= g_Min_Period[task])
+            {
+                printf("Configured offset of %s is not below its shortest period %u ms in all the modes\n",
+                       g_Tasks[task].Name, (unsigned)g_Min_Period[task]);
+            }
+            Tool_Place(task, g_Tasks[task].Offset, 1);
+            g_Order[g_Periodic_Tasks] = task;
+            g_Periodic_Tasks++;
+        }
+    }
+    peak = Tool_Peak(&spread);
+    printf("Configured offsets: peak tick load %lu us\n", (unsigned long)peak);
+
+    /* The configured offsets are the first bound of the search */
+    g_Best_Peak   = peak;
+    g_Best_Spread = spread;
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        g_Best_Offset[task] = g_Tasks[task].Offset;
+        if(g_Min_Period[task] != 0)
+        {
+            Tool_Place(task, g_Tasks[task].Offset, -1);
+        }
+    }
+
+    /* Heavy tasks first */
+    for(index = 1; index < g_Periodic_Tasks; index++)
+    {
+        for(task = index; (task > 0) && (g_Tasks[g_Order[task]].Wcet > g_Tasks[g_Order[task - 1]].Wcet); task--)
+        {
+            swap              = g_Order[task];
+            g_Order[task]     = g_Order[task - 1];
+            g_Order[task - 1] = swap;
+        }
+    }
+
+    Tool_Search(0);
+
+    printf("Optimized offsets: peak tick load %lu us%s\n\n", (unsigned long)g_Best_Peak,
+           (g_Visited_Nodes > TOOL_MAX_VISITED_NODES) ? " (search budget reached)" : "");
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        snprintf(name, sizeof(name), "OsConf_%s_TASK_OFFSET", g_Tasks[task].Name);
+        printf("#define %-36s(%uU)\n", name, (unsigned)g_Best_Offset[task]);
+    }
+
+    return 0;
+}